@@ -8,6 +8,10 @@ fonts to be used with the Adafruit_GFX Arduino library.
 For UNIX-like systems.  Outputs to stdout; redirect to header file, e.g.:
   ./fontconvert ~/Library/Fonts/FreeSans.ttf 18 > FreeSans18pt7b.h
 
+With -r the glyph bitmaps are run length encoded (RleFont, see
+src/lib/ui.h of the watch firmware) instead of bit-packed:
+  ./fontconvert -r ~/Library/Fonts/FreeSans.ttf 36 > FreeSans36pt7b_rle.h
+
 REQUIRES FREETYPE LIBRARY.  www.freetype.org
 
 Currently this only extracts the printable 7-bit ASCII chars of a font.
@@ -29,25 +33,67 @@ See notes at end for glyph nomenclature & other tidbits.
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
+// Write one byte of the bitmap table, with periodic newline
+void enbyte(uint8_t value) {
+  static uint8_t row = 0, firstCall = 1;
+  if (!firstCall) {    // Format output table nicely
+    if (++row >= 12) { // Last entry on line?
+      printf(",\n  "); //   Newline format output
+      row = 0;         //   Reset row counter
+    } else {           // Not end of line
+      printf(", ");    //   Simple comma delim
+    }
+  }
+  printf("0x%02X", value); // Write byte value
+  firstCall = 0;           // Formatting flag
+}
+
 // Accumulate bits for output, with periodic hexadecimal byte write
 void enbit(uint8_t value) {
-  static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
+  static uint8_t sum = 0, bit = 0x80;
   if (value)
-    sum |= bit;          // Set bit if needed
-  if (!(bit >>= 1)) {    // Advance to next bit, end of byte reached?
-    if (!firstCall) {    // Format output table nicely
-      if (++row >= 12) { // Last entry on line?
-        printf(",\n  "); //   Newline format output
-        row = 0;         //   Reset row counter
-      } else {           // Not end of line
-        printf(", ");    //   Simple comma delim
+    sum |= bit;       // Set bit if needed
+  if (!(bit >>= 1)) { // Advance to next bit, end of byte reached?
+    enbyte(sum);      // Write byte value
+    sum = 0;          // Clear for next byte
+    bit = 0x80;       // Reset bit counter
+  }
+}
+
+// Write one run of the RLE format, returns the number of bytes written.
+// Runs longer than 255 are split with an empty run of the other color.
+int enrun(int length) {
+  int bytes = 1;
+  while (length > 255) {
+    enbyte(255);
+    enbyte(0);
+    length -= 255;
+    bytes += 2;
+  }
+  enbyte(length);
+  return bytes;
+}
+
+// Run length encode a glyph: the pixels are walked column by column (top
+// to bottom, then left to right) and stored as the lengths of alternating
+// runs of background and ink, starting with background. The runs cover
+// every pixel of the glyph. Returns the number of bytes written.
+int enrle(FT_Bitmap *bitmap) {
+  int x, y, ink = 0, length = 0, bytes = 0;
+  for (x = 0; x < bitmap->width; x++) {
+    for (y = 0; y < bitmap->rows; y++) {
+      int pixel = (bitmap->buffer[y * bitmap->pitch + x / 8] >> (7 - (x & 7))) & 1;
+      if (pixel != ink) {
+        bytes += enrun(length);
+        ink = pixel;
+        length = 0;
       }
+      length++;
     }
-    printf("0x%02X", sum); // Write byte value
-    sum = 0;               // Clear for next byte
-    bit = 0x80;            // Reset bit counter
-    firstCall = 0;         // Formatting flag
   }
+  if (length)
+    bytes += enrun(length);
+  return bytes;
 }
 
 int main(int argc, char *argv[]) {
@@ -60,6 +106,7 @@ int main(int argc, char *argv[]) {
   FT_BitmapGlyphRec *g;
   GFXglyph *table;
   uint8_t bit;
+  int rle = 0;
 
   // Parse command line.  Valid syntaxes are:
   //   fontconvert [filename] [size]
@@ -67,9 +114,16 @@ int main(int argc, char *argv[]) {
   //   fontconvert [filename] [size] [first char] [last char]
   // Unless overridden, default first and last chars are
   // ' ' (space) and '~', respectively
+  // Any of these can start with -r for run length encoded bitmaps
+
+  if ((argc > 1) && !strcmp(argv[1], "-r")) {
+    rle = 1;
+    argc--;
+    argv++;
+  }
 
   if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+    fprintf(stderr, "Usage: %s [-r] fontfile size [first] [last]\n", argv[0]);
     return 1;
   }
 
@@ -145,7 +199,11 @@ int main(int argc, char *argv[]) {
   // the right symbols, and that's not done yet.
   // fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
 
-  printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+  if (rle) {
+    printf("const uint8_t %sRuns[] PROGMEM = {\n  ", fontName);
+  } else {
+    printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+  }
 
   // Process glyphs and output huge bitmap data array
   for (i = first, j = 0; i <= last; i++, j++) {
@@ -184,6 +242,12 @@ int main(int argc, char *argv[]) {
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
+    if (rle) {
+      bitmapOffset += enrle(bitmap);
+      FT_Done_Glyph(glyph);
+      continue;
+    }
+
     for (y = 0; y < bitmap->rows; y++) {
       for (x = 0; x < bitmap->width; x++) {
         byte = x / 8;
@@ -207,7 +271,8 @@ int main(int argc, char *argv[]) {
   printf(" };\n\n"); // End bitmap array
 
   // Output glyph attributes table (one per character)
-  printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", fontName);
+  printf("const GFXglyph %s%sGlyphs[] PROGMEM = {\n", fontName,
+         rle ? "Rle" : "");
   for (i = first, j = 0; i <= last; i++, j++) {
     printf("  { %5d, %3d, %3d, %3d, %4d, %4d }", table[j].bitmapOffset,
            table[j].width, table[j].height, table[j].xAdvance, table[j].xOffset,
@@ -226,15 +291,22 @@ int main(int argc, char *argv[]) {
   printf("\n\n");
 
   // Output font structure
-  printf("const GFXfont %s PROGMEM = {\n", fontName);
-  printf("  (uint8_t  *)%sBitmaps,\n", fontName);
-  printf("  (GFXglyph *)%sGlyphs,\n", fontName);
+  if (rle) {
+    printf("const RleFont %sRle PROGMEM = {{\n", fontName);
+    printf("  (uint8_t  *)%sRuns,\n", fontName);
+    printf("  (GFXglyph *)%sRleGlyphs,\n", fontName);
+  } else {
+    printf("const GFXfont %s PROGMEM = {\n", fontName);
+    printf("  (uint8_t  *)%sBitmaps,\n", fontName);
+    printf("  (GFXglyph *)%sGlyphs,\n", fontName);
+  }
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
-    printf("  0x%02X, 0x%02X, %d };\n\n", first, last, table[0].height);
+    printf("  0x%02X, 0x%02X, %d }%s;\n\n", first, last, table[0].height,
+           rle ? "}" : "");
   } else {
-    printf("  0x%02X, 0x%02X, %ld };\n\n", first, last,
-           face->size->metrics.height >> 6);
+    printf("  0x%02X, 0x%02X, %ld }%s;\n\n", first, last,
+           face->size->metrics.height >> 6, rle ? "}" : "");
   }
   printf("// Approx. %d bytes\n", bitmapOffset + (last - first + 1) * 7 + 7);
   // Size estimate is based on AVR struct and pointer sizes;
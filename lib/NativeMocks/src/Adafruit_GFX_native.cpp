@@ -0,0 +1,3 @@
+// The Adafruit GFX library in lib/ also contains the SPI TFT and OLED drivers which do not build on the host,
+// the native environment ignores that library and only builds the core graphics code from here
+#include "../../Adafruit-GFX/Adafruit_GFX.cpp"
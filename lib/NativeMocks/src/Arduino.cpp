@@ -0,0 +1,122 @@
+#include "Arduino.h"
+
+#include <chrono>
+#include <cstdarg>
+#include <thread>
+
+HardwareSerial Serial;
+
+static const auto bootTime = std::chrono::steady_clock::now();
+static uint32_t cpuFrequencyMhz = 240;
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime).count();
+}
+
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t val) {}
+// The button is active low, report it as released
+int digitalRead(uint8_t pin) { return HIGH; }
+// Roughly a full battery (~1.8V after the divider)
+uint16_t analogRead(uint8_t pin) { return 2230; }
+
+uint32_t getCpuFrequencyMhz() { return cpuFrequencyMhz; }
+
+bool setCpuFrequencyMhz(uint32_t cpu_freq_mhz) {
+  cpuFrequencyMhz = cpu_freq_mhz;
+  return true;
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+// String
+
+String::String(float value, unsigned int decimals) : String((double)value, decimals) {}
+
+String::String(double value, unsigned int decimals) {
+  char buf[33];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+  _str = buf;
+}
+
+int String::indexOf(const char *str, unsigned int from) const {
+  size_t pos = _str.find(str, from);
+  return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to)
+    std::swap(from, to);
+  if (from >= _str.length())
+    return String();
+  return String(_str.substr(from, to - from));
+}
+
+void String::trim() {
+  size_t first = _str.find_first_not_of(" \t\r\n");
+  size_t last = _str.find_last_not_of(" \t\r\n");
+  _str = first == std::string::npos ? "" : _str.substr(first, last - first + 1);
+}
+
+// Print
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--)
+    n += write(*buffer++);
+  return n;
+}
+
+size_t Print::write(const char *str) { return str ? write((const uint8_t *)str, strlen(str)) : 0; }
+
+size_t Print::print(const char *str) { return write(str); }
+size_t Print::print(const String &str) { return write(str.c_str()); }
+size_t Print::print(const __FlashStringHelper *str) { return write(reinterpret_cast<const char *>(str)); }
+size_t Print::print(char c) { return write((uint8_t)c); }
+size_t Print::print(int value, int base) { return print((long)value, base); }
+size_t Print::print(unsigned int value, int base) { return print((unsigned long)value, base); }
+
+size_t Print::print(long value, int base) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), base == HEX ? "%lX" : "%ld", value);
+  return write(buf);
+}
+
+size_t Print::print(unsigned long value, int base) {
+  char buf[24];
+  snprintf(buf, sizeof(buf), base == HEX ? "%lX" : "%lu", value);
+  return write(buf);
+}
+
+size_t Print::print(double value, int digits) {
+  char buf[33];
+  snprintf(buf, sizeof(buf), "%.*f", digits, value);
+  return write(buf);
+}
+
+size_t Print::println() { return write("\r\n"); }
+
+size_t Print::printf(const char *format, ...) {
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  return len > 0 ? write((const uint8_t *)buf, std::min((size_t)len, sizeof(buf) - 1)) : 0;
+}
+
+// Serial goes to stdout
+
+size_t HardwareSerial::write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
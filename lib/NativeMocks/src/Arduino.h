@@ -0,0 +1,75 @@
+#pragma once
+
+// Minimal Arduino core for running the watch UI code on the host (env:native)
+// Only what the code in src/ and Adafruit GFX actually use is provided
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "WString.h"
+
+#ifndef ARDUINO
+#define ARDUINO 100
+#endif
+
+#define PROGMEM
+#define RTC_DATA_ATTR
+#define RTC_FAST_ATTR
+#define ARDUINO_ISR_ATTR
+#define IRAM_ATTR
+
+#define pgm_read_byte(addr)    (*(const unsigned char *)(addr))
+#define pgm_read_word(addr)    (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr)   (*(const unsigned long *)(addr))
+#define pgm_read_ptr(addr)     (*(void *const *)(addr))
+
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+#define HIGH          0x1
+#define LOW           0x0
+#define INPUT         0x01
+#define OUTPUT        0x03
+#define INPUT_PULLUP  0x05
+#define ANALOG        0xC0
+
+using std::max;
+using std::min;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+
+uint32_t getCpuFrequencyMhz();
+bool setCpuFrequencyMhz(uint32_t cpu_freq_mhz);
+
+template <class T, class L, class H> auto constrain(T amt, L low, H high) -> decltype(amt < low ? low : (amt > high ? high : amt)) {
+  return amt < low ? low : (amt > high ? high : amt);
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+#include "Print.h"
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) {}
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,34 @@
+#include "ESP32Time.h"
+
+void ESP32Time::setTime(unsigned long epoch, int ms) {
+  _epoch = epoch;
+  _micros = ms;
+}
+
+void ESP32Time::setTime(int sc, int mn, int hr, int dy, int mt, int yr, int ms) {
+  struct tm t = {0};
+  t.tm_year = yr - 1900;
+  t.tm_mon = mt - 1;
+  t.tm_mday = dy;
+  t.tm_hour = hr;
+  t.tm_min = mn;
+  t.tm_sec = sc;
+  setTime(timegm(&t), ms);
+}
+
+tm ESP32Time::getTimeStruct() {
+  time_t now = _epoch + _offset;
+  struct tm timeinfo;
+  gmtime_r(&now, &timeinfo);
+  return timeinfo;
+}
+
+unsigned long ESP32Time::getEpoch() { return _epoch; }
+
+int ESP32Time::getHour(bool mode) {
+  int hour = getTimeStruct().tm_hour;
+  if (mode)
+    return hour;
+  hour = hour % 12;
+  return hour == 0 ? 12 : hour;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+// Host stand-in for ESP32Time, the time is kept in the object so renders are reproducible
+
+#include "Arduino.h"
+#include <ctime>
+
+class ESP32Time {
+public:
+  ESP32Time(unsigned long offset = 0) : _offset(offset) {}
+  void setTime(unsigned long epoch = 1609459200, int ms = 0); // default (1609459200) = 1st Jan 2021
+  void setTime(int sc, int mn, int hr, int dy, int mt, int yr, int ms = 0);
+  tm getTimeStruct();
+
+  unsigned long getEpoch();
+  unsigned long getLocalEpoch() { return getEpoch() + _offset; }
+  unsigned long getMillis() { return _micros / 1000; }
+  unsigned long getMicros() { return _micros; }
+  int getSecond() { return getTimeStruct().tm_sec; }
+  int getMinute() { return getTimeStruct().tm_min; }
+  int getHour(bool mode = false);
+  int getDay() { return getTimeStruct().tm_mday; }
+  int getDayofWeek() { return getTimeStruct().tm_wday; }
+  int getDayofYear() { return getTimeStruct().tm_yday; }
+  int getMonth() { return getTimeStruct().tm_mon; }
+  int getYear() { return getTimeStruct().tm_year + 1900; }
+
+private:
+  unsigned long _offset;
+  unsigned long _epoch = 1609459200;
+  unsigned long _micros = 0;
+};
@@ -0,0 +1,95 @@
+#include "GxDEPG0150BN.h"
+
+GxDEPG0150BN::GxDEPG0150BN(GxIO &io, int8_t rst, int8_t busy) : GxDEPG0150BN() {}
+
+GxDEPG0150BN::GxDEPG0150BN()
+    : GxEPD(GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT), _buffer(GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT),
+      _panel(GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT), _stats() {
+  _buffer.fillScreen(GxEPD_WHITE);
+  _panel.fillScreen(GxEPD_WHITE);
+}
+
+void GxDEPG0150BN::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+    return;
+
+  // Same transformation as the real driver
+  switch (getRotation()) {
+  case 1:
+    std::swap(x, y);
+    x = GxDEPG0150BN_WIDTH - x - 1;
+    break;
+  case 2:
+    x = GxDEPG0150BN_WIDTH - x - 1;
+    y = GxDEPG0150BN_HEIGHT - y - 1;
+    break;
+  case 3:
+    std::swap(x, y);
+    y = GxDEPG0150BN_HEIGHT - y - 1;
+    break;
+  }
+  _stats.pixelWrites++;
+  _buffer.drawPixel(x, y, color);
+}
+
+void GxDEPG0150BN::init(uint32_t serial_diag_bitrate) {}
+
+void GxDEPG0150BN::fillScreen(uint16_t color) { _buffer.fillScreen(color); }
+
+void GxDEPG0150BN::update(void) {
+  memcpy(_panel.getBuffer(), _buffer.getBuffer(), GxDEPG0150BN_BUFFER_SIZE);
+  _stats.fullUpdates++;
+  _stats.refreshedPixels += GxDEPG0150BN_WIDTH * GxDEPG0150BN_HEIGHT;
+}
+
+void GxDEPG0150BN::updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation) {
+  if (using_rotation) {
+    switch (getRotation()) {
+    case 1:
+      std::swap(x, y);
+      std::swap(w, h);
+      x = GxDEPG0150BN_WIDTH - x - w;
+      break;
+    case 2:
+      x = GxDEPG0150BN_WIDTH - x - w;
+      y = GxDEPG0150BN_HEIGHT - y - h;
+      break;
+    case 3:
+      std::swap(x, y);
+      std::swap(w, h);
+      y = GxDEPG0150BN_HEIGHT - y - h;
+      break;
+    }
+  }
+  if (x >= GxDEPG0150BN_WIDTH || y >= GxDEPG0150BN_HEIGHT)
+    return;
+  w = std::min<uint16_t>(w, GxDEPG0150BN_WIDTH - x);
+  h = std::min<uint16_t>(h, GxDEPG0150BN_HEIGHT - y);
+
+  // Like the controller, the window is transferred in whole bytes
+  uint16_t xs = x & ~7;
+  uint16_t xe = (x + w + 7) & ~7;
+  for (uint16_t row = y; row < y + h; row++) {
+    uint32_t offset = (uint32_t)row * (GxDEPG0150BN_WIDTH / 8) + xs / 8;
+    memcpy(_panel.getBuffer() + offset, _buffer.getBuffer() + offset, (xe - xs) / 8);
+  }
+  _stats.windowUpdates++;
+  _stats.refreshedPixels += (uint32_t)(xe - xs) * h;
+}
+
+void GxDEPG0150BN::powerDown() { _stats.powerDowns++; }
+
+bool GxDEPG0150BN::writePBM(const char *path) const {
+  FILE *file = fopen(path, "wb");
+  if (!file)
+    return false;
+
+  // PBM uses 1 for black, the panel buffer uses 1 for white
+  fprintf(file, "P4\n%d %d\n", GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT);
+  const uint8_t *frame = _panel.getBuffer();
+  for (uint32_t i = 0; i < GxDEPG0150BN_BUFFER_SIZE; i++) {
+    fputc(~frame[i] & 0xFF, file);
+  }
+  fclose(file);
+  return true;
+}
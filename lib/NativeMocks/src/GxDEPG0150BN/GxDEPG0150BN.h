@@ -0,0 +1,53 @@
+#pragma once
+
+// Host stand-in for the 1.54" b/w 200x200 GDEP015OC1 / DEPG0150BN display driver
+//
+// The display buffer is a GFXcanvas1 in the native (unrotated) layout of the panel, just like the buffer of
+// the real driver. update() and updateWindow() copy the buffer to a second canvas which represents what is
+// visible on the panel, that one can be written to a PBM file to look at the result.
+
+#include "../GxEPD.h"
+
+#define GxDEPG0150BN_WIDTH       200
+#define GxDEPG0150BN_HEIGHT      200
+#define GxDEPG0150BN_BUFFER_SIZE (uint32_t(GxDEPG0150BN_WIDTH) * uint32_t(GxDEPG0150BN_HEIGHT) / 8)
+
+#define GxEPD_Class  GxDEPG0150BN
+#define GxEPD_WIDTH  GxDEPG0150BN_WIDTH
+#define GxEPD_HEIGHT GxDEPG0150BN_HEIGHT
+
+// Counters to compare the cost of different ways of drawing the same screen
+struct GxEPDStats {
+  uint32_t pixelWrites;     // drawPixel() calls into the display buffer
+  uint32_t fullUpdates;     // update() calls (full flashing refresh)
+  uint32_t windowUpdates;   // updateWindow() calls (partial refresh)
+  uint32_t refreshedPixels; // Area of the panel refreshed by all updates
+  uint32_t powerDowns;
+};
+
+class GxIO;
+
+class GxDEPG0150BN : public GxEPD {
+public:
+  GxDEPG0150BN(GxIO &io, int8_t rst = -1, int8_t busy = -1);
+  GxDEPG0150BN();
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void init(uint32_t serial_diag_bitrate = 0) override;
+  void fillScreen(uint16_t color) override;
+  void update(void) override;
+  void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true) override;
+  void powerDown() override;
+
+  // Host only
+  const GxEPDStats &stats() const { return _stats; }
+  void resetStats() { _stats = GxEPDStats(); }
+  // Raw 1bpp frame as shown on the panel, same layout as the display buffer (1 = white)
+  const uint8_t *panel() const { return _panel.getBuffer(); }
+  // Write what is visible on the panel to a (binary) PBM file
+  bool writePBM(const char *path) const;
+
+private:
+  GFXcanvas1 _buffer;
+  GFXcanvas1 _panel;
+  GxEPDStats _stats;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+// Host stand-in for the GxEPD base class (zinggjm/GxEPD), only the API used by the watch is provided
+
+#include "Adafruit_GFX.h"
+#include "Arduino.h"
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+class GxEPD : public Adafruit_GFX {
+public:
+  // bitmap presentation modes may be partially implemented by subclasses
+  enum bm_mode {
+    bm_normal = 0,
+    bm_default = 1,
+    bm_invert = (1 << 1),
+    bm_flip_x = (1 << 2),
+    bm_flip_y = (1 << 3),
+    bm_r90 = (1 << 4),
+    bm_r180 = (1 << 5),
+    bm_r270 = bm_r90 | bm_r180,
+    bm_partial_update = (1 << 6),
+    bm_invert_red = (1 << 7),
+    bm_transparent = (1 << 8)
+  };
+
+  GxEPD(int16_t w, int16_t h) : Adafruit_GFX(w, h) {}
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+  virtual void init(uint32_t serial_diag_bitrate = 0) = 0;
+  virtual void fillScreen(uint16_t color) = 0;
+  virtual void update(void) = 0;
+  virtual void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true) {}
+  virtual void powerDown() = 0;
+  using Adafruit_GFX::drawBitmap;
+};
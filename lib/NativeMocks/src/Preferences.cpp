@@ -0,0 +1,41 @@
+#include "Preferences.h"
+
+bool Preferences::clear() {
+  _values.clear();
+  return true;
+}
+
+bool Preferences::remove(const char *key) { return _values.erase(key) > 0; }
+
+bool Preferences::isKey(const char *key) { return _values.count(key) > 0; }
+
+size_t Preferences::putString(const char *key, const char *value) { return putBytes(key, value, strlen(value) + 1) - 1; }
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  writes++;
+  const uint8_t *bytes = (const uint8_t *)value;
+  _values[key] = std::vector<uint8_t>(bytes, bytes + len);
+  return len;
+}
+
+String Preferences::getString(const char *key, String defaultValue) {
+  reads++;
+  auto it = _values.find(key);
+  if (it == _values.end() || it->second.empty())
+    return defaultValue;
+  return String((const char *)it->second.data());
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  auto it = _values.find(key);
+  return it == _values.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  reads++;
+  auto it = _values.find(key);
+  if (it == _values.end() || it->second.size() > maxLen)
+    return 0;
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
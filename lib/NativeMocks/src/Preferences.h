@@ -0,0 +1,49 @@
+#pragma once
+
+// Host stand-in for the ESP32 Preferences (NVS) library, values only live as long as the process
+
+#include "Arduino.h"
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+  bool begin(const char *name, bool readOnly = false, const char *partition_label = NULL) { return true; }
+  void end() {}
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+
+  size_t putInt(const char *key, int32_t value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putUInt(const char *key, uint32_t value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putLong64(const char *key, int64_t value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putFloat(const char *key, float value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putBool(const char *key, bool value) { return putBytes(key, &value, sizeof(value)); }
+  size_t putString(const char *key, const char *value);
+  size_t putString(const char *key, String value) { return putString(key, value.c_str()); }
+  size_t putBytes(const char *key, const void *value, size_t len);
+
+  int32_t getInt(const char *key, int32_t defaultValue = 0) { return get(key, defaultValue); }
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0) { return get(key, defaultValue); }
+  int64_t getLong64(const char *key, int64_t defaultValue = 0) { return get(key, defaultValue); }
+  float getFloat(const char *key, float defaultValue = NAN) { return get(key, defaultValue); }
+  bool getBool(const char *key, bool defaultValue = false) { return get(key, defaultValue); }
+  String getString(const char *key, String defaultValue = String());
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buf, size_t maxLen);
+
+  // Host only, number of reads and writes to compare the NVS traffic of a wake
+  uint32_t reads = 0;
+  uint32_t writes = 0;
+
+private:
+  template <typename T> T get(const char *key, T defaultValue) {
+    T value = defaultValue;
+    if (getBytesLength(key) == sizeof(T))
+      getBytes(key, &value, sizeof(T));
+    return value;
+  }
+
+  std::map<std::string, std::vector<uint8_t>> _values;
+};
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+class __FlashStringHelper;
+
+/**
+ * The Arduino String on top of std::string, enough for the string building done in src/
+ */
+class String {
+public:
+  String() {}
+  String(const char *cstr) : _str(cstr ? cstr : "") {}
+  String(const std::string &str) : _str(str) {}
+  String(const __FlashStringHelper *str) : _str(reinterpret_cast<const char *>(str)) {}
+  explicit String(char c) : _str(1, c) {}
+  explicit String(int value) : _str(std::to_string(value)) {}
+  explicit String(unsigned int value) : _str(std::to_string(value)) {}
+  explicit String(long value) : _str(std::to_string(value)) {}
+  explicit String(unsigned long value) : _str(std::to_string(value)) {}
+  explicit String(long long value) : _str(std::to_string(value)) {}
+  explicit String(float value, unsigned int decimals = 2);
+  explicit String(double value, unsigned int decimals = 2);
+
+  const char *c_str() const { return _str.c_str(); }
+  unsigned int length() const { return _str.length(); }
+  bool reserve(unsigned int size) {
+    _str.reserve(size);
+    return true;
+  }
+  char operator[](unsigned int index) const { return index < _str.length() ? _str[index] : 0; }
+
+  int indexOf(const char *str, unsigned int from = 0) const;
+  String substring(unsigned int from) const { return from < _str.length() ? String(_str.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const;
+  long toInt() const { return strtol(_str.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(_str.c_str(), nullptr); }
+  void trim();
+
+  bool concat(const String &str) {
+    _str += str._str;
+    return true;
+  }
+  bool concat(const char *cstr) {
+    _str += cstr;
+    return true;
+  }
+  bool concat(char c) {
+    _str += c;
+    return true;
+  }
+  // Used by ArduinoJson to write into a String
+  size_t write(uint8_t c) {
+    _str += (char)c;
+    return 1;
+  }
+
+  String &operator+=(const String &rhs) {
+    _str += rhs._str;
+    return *this;
+  }
+  String &operator+=(const char *rhs) {
+    _str += rhs;
+    return *this;
+  }
+  String &operator+=(char rhs) {
+    _str += rhs;
+    return *this;
+  }
+
+  bool operator==(const String &rhs) const { return _str == rhs._str; }
+  bool operator==(const char *rhs) const { return _str == rhs; }
+  bool operator!=(const String &rhs) const { return _str != rhs._str; }
+  bool operator!=(const char *rhs) const { return _str != rhs; }
+  bool operator<(const String &rhs) const { return _str < rhs._str; }
+
+  friend String operator+(const String &lhs, const String &rhs) { return String(lhs._str + rhs._str); }
+  friend String operator+(const String &lhs, const char *rhs) { return String(lhs._str + rhs); }
+  friend String operator+(const char *lhs, const String &rhs) { return String(lhs + rhs._str); }
+  friend String operator+(const String &lhs, char rhs) { return String(lhs._str + rhs); }
+  friend String operator+(const String &lhs, int rhs) { return lhs + String(rhs); }
+  friend String operator+(const String &lhs, unsigned int rhs) { return lhs + String(rhs); }
+  friend String operator+(const String &lhs, long rhs) { return lhs + String(rhs); }
+  friend String operator+(const String &lhs, unsigned long rhs) { return lhs + String(rhs); }
+  friend String operator+(const String &lhs, float rhs) { return lhs + String(rhs); }
+  friend String operator+(const String &lhs, double rhs) { return lhs + String(rhs); }
+
+private:
+  std::string _str;
+};
@@ -0,0 +1,16 @@
+#pragma once
+
+// Host stand-in for the CRC functions in the ESP32 ROM
+
+#include <cstdint>
+
+// Same as the ROM version: crc32_le(0, buf, len) gives the standard (zlib) CRC-32
+static inline uint32_t crc32_le(uint32_t crc, uint8_t const *buf, uint32_t len) {
+  crc = ~crc;
+  while (len--) {
+    crc ^= *buf++;
+    for (uint8_t bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+  }
+  return ~crc;
+}
@@ -4,59 +4,119 @@ const char *months[] = {"January", "February", "March", "April", "May", "June",
 
 const char *days[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
 
-void drawHomeUI(GxEPD_Class *display, ESP32Time *rtc, int batteryStatus) {
-
-  String hoursFiller = rtc->getHour(true) < 10 ? "0" : "";
-  String minutesFiller = rtc->getMinute() < 10 ? "0" : "";
-  String timeStr = hoursFiller + String(rtc->getHour(true)) + ":" + minutesFiller + String(rtc->getMinute());
-
-  const unsigned char *icon_battery_small_array[6] = {epd_bitmap_icon_battery_0_small,  epd_bitmap_icon_battery_20_small,
-                                                      epd_bitmap_icon_battery_40_small, epd_bitmap_icon_battery_60_small,
-                                                      epd_bitmap_icon_battery_80_small, epd_bitmap_icon_battery_100_small};
-
-  // This is the only way I managed to get the screen to update properly without the full .update() function
-  // draw black box + white box over the screen
-  // We do this to solve the screen corruption problem that we get when using the updateWindow function
-  // It seems the screen does not really clear all black pixels when just drawing a white box over it
-  // NOTE: It might look like it works when plugged into the power, but soon as you use the battery the display falls apart
-  display->fillRect(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT, GxEPD_BLACK);
-  display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT, true);
-  display->fillRect(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT, GxEPD_WHITE);
-  display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT, true);
+// What the home screen elements on the panel currently show, kept next to the frame in RTC memory
+struct HomeState {
+  uint32_t checksum; // Of the fields below
+  int8_t hour;
+  int8_t minute;
+  int8_t day;
+  int8_t battery;
+  int16_t focusTime;
+  uint32_t weather; // Checksum of the weather text
+};
+
+RTC_DATA_ATTR HomeState homeState = {0};
+
+static uint32_t homeStateChecksum(const HomeState *state) {
+  return crc32_le(0, (const uint8_t *)state + sizeof(state->checksum), sizeof(HomeState) - sizeof(state->checksum));
+}
 
+// Areas (x, y, w, h) used by the elements of the home screen
+// Every element clears its own area before drawing, so it can be redrawn on top of the previous frame
+#define HOME_TIME_AREA    0, 64, 200, 58
+#define HOME_DATE_AREA    0, 138, 200, 28
+#define HOME_BATTERY_AREA 104, 0, 96, 32
+#define HOME_FOCUS_AREA   0, 0, 100, 24
+#define HOME_WIFI_AREA    2, 24, 28, 28
+#define HOME_WEATHER_AREA 0, 170, 200, 30
+
+// Where the text elements are anchored, the text of fixed format is checked against its area by the compiler
+#define HOME_FOCUS_X      4   // Left aligned
+#define HOME_BATTERY_X    166 // Right aligned, the icon follows
+#define HOME_DATE_X       100 // Centered
+
+static_assert(HOME_FOCUS_X + textWidth(Outfit_60011pt7bMetrics, "00:00") <= 100, "Focus time does not fit its area");
+static_assert(HOME_FOCUS_X + textWidth(Outfit_60011pt7bMetrics, "--:--") <= 100, "Focus time does not fit its area");
+static_assert(HOME_BATTERY_X - textWidth(Outfit_60011pt7bMetrics, "100%") >= 104, "Battery level does not fit its area");
+static_assert(textWidth(Outfit_60011pt7bMetrics, "Wed, September 30") <= 2 * HOME_DATE_X, "Longest date does not fit the screen");
+
+void drawHomeUI(WatchCanvas *display, ESP32Time *rtc, int batteryStatus) {
+
+  // The screen corruption (ghosting) problem that we get when using the updateWindow function is now
+  // handled by the FrameRenderer, it does the black box + white box pass for every area it refreshes
   display->fillScreen(GxEPD_WHITE);
-  display->setTextColor(GxEPD_BLACK);
-  display->setTextWrap(false);
 
-  // Time
-  display->setFont(&Outfit_80036pt7b);
-  printCenterString(display, timeStr.c_str(), 100, 118);
+  displayTime(display, rtc);
+  displayDate(display, rtc);
+  displayBatteryStatus(display, batteryStatus);
+}
 
-  // Display the Date
-  display->setFont(&Outfit_60011pt7b);
-  printCenterString(display, String(String(days[rtc->getDayofWeek()]) + ", " + String(months[rtc->getMonth()]) + " " + String(rtc->getDay())).c_str(),
-                    100, 158);
+void updateHomeUI(WatchCanvas *display, ESP32Time *rtc, int batteryStatus, int focusTime, String weatherCondition, String weatherTemp,
+                  bool fullRedraw) {
+  PROFILE_SCOPE(ProfileStage::DRAW_HOME);
+  HomeState next;
+  memset(&next, 0, sizeof(next)); // The padding is part of the checksum
+  next.hour = rtc->getHour(true);
+  next.minute = rtc->getMinute();
+  next.day = rtc->getDay();
+  next.battery = batteryStatus;
+  next.focusTime = focusTime;
+  String weatherText = weatherCondition + " " + weatherTemp;
+  next.weather = crc32_le(0, (const uint8_t *)weatherText.c_str(), weatherText.length());
+
+  // A corrupted state means we cannot trust the canvas either
+  if (homeState.checksum != homeStateChecksum(&homeState)) {
+    fullRedraw = true;
+  }
 
-  // Battery
-  printRightString(display, String(String(batteryStatus) + "%").c_str(), 166, 22);
-  // Draw icon
-  display->drawBitmap(170, 2, icon_battery_small_array[batteryStatus / 20], 28, 28, GxEPD_BLACK);
+  if (fullRedraw) {
+    drawHomeUI(display, rtc, batteryStatus);
+    displayWeather(display, weatherCondition, weatherTemp);
+    displayFocusTime(display, focusTime);
+  } else {
+    if (next.hour != homeState.hour || next.minute != homeState.minute) {
+      displayTime(display, rtc);
+    }
+    if (next.day != homeState.day) {
+      displayDate(display, rtc);
+    }
+    if (next.battery != homeState.battery) {
+      displayBatteryStatus(display, batteryStatus);
+    }
+    if (next.focusTime != homeState.focusTime) {
+      displayFocusTime(display, focusTime);
+    }
+    if (next.weather != homeState.weather) {
+      displayWeather(display, weatherCondition, weatherTemp);
+    }
+  }
+
+  next.checksum = homeStateChecksum(&next);
+  homeState = next;
 }
 
 /**
  * Show the Wifi is disabled icon (indicates that the wifi connection failed)
  */
-void disableWifiDisplay(GxEPD_Class *display) { display->drawBitmap(2, 24, icon_no_ble_small, 28, 28, GxEPD_BLACK); }
+void disableWifiDisplay(WatchCanvas *display) {
+  display->fillRect(HOME_WIFI_AREA, GxEPD_WHITE);
+  display->drawRotatedBitmap(2, 24, icon_no_ble_small_r1, 28, 28, GxEPD_BLACK);
+}
 
 /**
  * Add the wifi - is active - icon to the display
  */
-void enableWifiDisplay(GxEPD_Class *display) { display->drawBitmap(2, 24, icon_wifi_small, 28, 28, GxEPD_BLACK); }
+void enableWifiDisplay(WatchCanvas *display) {
+  display->fillRect(HOME_WIFI_AREA, GxEPD_WHITE);
+  display->drawRotatedBitmap(2, 24, icon_wifi_small_r1, 28, 28, GxEPD_BLACK);
+}
 
 /**
  * Display the weather condition and temp
  */
-void displayWeather(GxEPD_Class *display, String weatherCondition, String weatherTemp) {
+void displayWeather(WatchCanvas *display, String weatherCondition, String weatherTemp) {
+  // Clear the old weather first, a partial redraw starts from the previous frame
+  display->fillRect(HOME_WEATHER_AREA, GxEPD_WHITE);
 
   // Check if the weather condition is empty
   if (weatherCondition.length() == 0 || weatherCondition == "Unknown") {
@@ -72,45 +132,59 @@ void displayWeather(GxEPD_Class *display, String weatherCondition, String weathe
 
   // Weather condition (bottom of the screen)
   // N x,y
-  display->setFont(&Outfit_60011pt7b);
-  printLeftString(display, weatherText.c_str(), 4, 190);
+  printLeftString(display, &Outfit_60011pt7b, weatherText.c_str(), 4, 190, GxEPD_BLACK);
 }
 
 /**
  * If the focus time is running display it, once we get to 0 we stop and leave it at 0
  */
-void displayFocusTime(GxEPD_Class *display, int focusTime) {
+void displayFocusTime(WatchCanvas *display, int focusTime) {
 
+  display->fillRect(HOME_FOCUS_AREA, GxEPD_WHITE);
   if (focusTime > 0) {
     // Focus Time
-    display->setFont(&Outfit_60011pt7b);
     String hoursFiller = focusTime < 10 ? "0" : "";
     String timeStr = hoursFiller + String(focusTime) + ":00";
-    printLeftString(display, timeStr.c_str(), 4, 22);
+    printLeftString(display, &Outfit_60011pt7b, timeStr.c_str(), HOME_FOCUS_X, 22, GxEPD_BLACK);
   } else {
     String a = "--:--";
-    printLeftString(display, a.c_str(), 4, 22);
+    printLeftString(display, &Outfit_60011pt7b, a.c_str(), HOME_FOCUS_X, 22, GxEPD_BLACK);
   }
 }
 
 /**
  * Display the time
  */
-void displayTime(GxEPD_Class *display, ESP32Time *rtc) {
+void displayTime(WatchCanvas *display, ESP32Time *rtc) {
   // Time
-  display->setFont(&Outfit_80036pt7b);
+  display->fillRect(HOME_TIME_AREA, GxEPD_WHITE);
   String hoursFiller = rtc->getHour(true) < 10 ? "0" : "";
   String minutesFiller = rtc->getMinute() < 10 ? "0" : "";
   String timeStr = hoursFiller + String(rtc->getHour(true)) + ":" + minutesFiller + String(rtc->getMinute());
-  printCenterString(display, timeStr.c_str(), 100, 118);
-  display->updateWindow(0, 60, 200, 60, true);
+  // The big clock digits are pre-rasterized sprites, copying them is much cheaper than drawing the glyphs
+  printCenterDigits(display, &Outfit_80036pt7bDigits, &Outfit_80036pt7bRle, timeStr.c_str(), 100, 118);
+}
+
+/**
+ * Display the date, eg: Mon, January 1
+ */
+void displayDate(WatchCanvas *display, ESP32Time *rtc) {
+  display->fillRect(HOME_DATE_AREA, GxEPD_WHITE);
+  String date = String(days[rtc->getDayofWeek()]) + ", " + String(months[rtc->getMonth()]) + " " + String(rtc->getDay());
+  printCenterString(display, &Outfit_60011pt7b, date.c_str(), HOME_DATE_X, 158, GxEPD_BLACK);
 }
 
 /**
- * Display the battery status and refresh the display
+ * Display the battery status (level + icon)
  */
-void displayBatteryStatus(GxEPD_Class *display, int batteryStatus) {
+void displayBatteryStatus(WatchCanvas *display, int batteryStatus) {
+  const unsigned char *icon_battery_small_array[6] = {epd_bitmap_icon_battery_0_small_r1,  epd_bitmap_icon_battery_20_small_r1,
+                                                      epd_bitmap_icon_battery_40_small_r1, epd_bitmap_icon_battery_60_small_r1,
+                                                      epd_bitmap_icon_battery_80_small_r1, epd_bitmap_icon_battery_100_small_r1};
+
   // Battery
-  printRightString(display, String(String(batteryStatus) + "%").c_str(), 166, 22);
-  // display->updateWindow(166, 0, 34, 34, true);
-}
\ No newline at end of file
+  display->fillRect(HOME_BATTERY_AREA, GxEPD_WHITE);
+  printRightString(display, &Outfit_60011pt7b, String(String(batteryStatus) + "%").c_str(), HOME_BATTERY_X, 22, GxEPD_BLACK);
+  // Draw icon
+  display->drawRotatedBitmap(170, 2, icon_battery_small_array[batteryStatus / 20], 28, 28, GxEPD_BLACK);
+}
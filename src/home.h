@@ -5,17 +5,31 @@
 #include "GxDEPG0150BN/GxDEPG0150BN.h" // 1.54 b/w 200x200
 #include "GxEPD.h"
 
+#include "lib/canvas.h"
+#include "lib/digits.h"
+#include "lib/metrics.h"
+#include "lib/profile.h"
 #include "lib/ui.h"
+#include "rom/crc.h"
 
 #include "resources/fonts/Outfit_60011pt7b.h"
-#include "resources/fonts/Outfit_80036pt7b.h"
+#include "resources/fonts/Outfit_60011pt7b_metrics.h"
+#include "resources/fonts/Outfit_80036pt7b_digits.h"
+#include "resources/fonts/Outfit_80036pt7b_rle.h"
 #include "resources/icons.h"
+#include "resources/icons_rotated.h"
 
-void drawHomeUI(GxEPD_Class *display, ESP32Time *rtc, int batteryStatus);
-void disableWifiDisplay(GxEPD_Class *display);
-void enableWifiDisplay(GxEPD_Class *display);
-void displayWeather(GxEPD_Class *display, String weatherCondition, String weatherTemp);
-void displayBatteryStatus(GxEPD_Class *display, int batteryStatus);
-void displayFocusTime(GxEPD_Class *display, int focusTime);
-void displayTime(GxEPD_Class *display, ESP32Time *rtc);
-void displayBatteryStatus(GxEPD_Class *display, int batteryStatus);
\ No newline at end of file
+// The home screen is drawn into the canvas of the FrameRenderer
+// Nothing is sent to the panel here, call flush() on the renderer once the frame is complete
+void drawHomeUI(WatchCanvas *display, ESP32Time *rtc, int batteryStatus);
+// Draw the complete home screen, or when fullRedraw is false only the elements which changed since the last call
+// fullRedraw must be set when the canvas does not hold the previous home screen (eg: the frame was not restored)
+void updateHomeUI(WatchCanvas *display, ESP32Time *rtc, int batteryStatus, int focusTime, String weatherCondition, String weatherTemp,
+                  bool fullRedraw);
+void disableWifiDisplay(WatchCanvas *display);
+void enableWifiDisplay(WatchCanvas *display);
+void displayWeather(WatchCanvas *display, String weatherCondition, String weatherTemp);
+void displayFocusTime(WatchCanvas *display, int focusTime);
+void displayTime(WatchCanvas *display, ESP32Time *rtc);
+void displayDate(WatchCanvas *display, ESP32Time *rtc);
+void displayBatteryStatus(WatchCanvas *display, int batteryStatus);
\ No newline at end of file
@@ -1,20 +1,113 @@
 #include "battery.h"
 
+struct BatteryPoint {
+  uint16_t mv;
+  uint8_t level;
+};
+
+// Resting voltage of a 1S LiPo against its charge, the curve is flat in the middle and steep at both ends
+static const BatteryPoint dischargeCurve[] = {
+    {3300, 0},  {3610, 5},  {3690, 10}, {3710, 15}, {3730, 20}, {3750, 25}, {3770, 30}, {3790, 35}, {3800, 40}, {3820, 45}, {3840, 50},
+    {3850, 55}, {3870, 60}, {3910, 65}, {3950, 70}, {3980, 75}, {4020, 80}, {4080, 85}, {4110, 90}, {4150, 95}, {4200, 100},
+};
+
+struct BatteryState {
+  uint32_t magic;
+  uint32_t mvX16;     // Average battery voltage (mV * 16, the fraction keeps the average from sticking)
+  uint32_t currentUa; // Average current drawn, from the awake and sleep times of the last wakes
+};
+
+RTC_DATA_ATTR BatteryState battery;
+
+static void batteryBegin() {
+  if (battery.magic == BATTERY_MAGIC)
+    return;
+  memset(&battery, 0, sizeof(battery));
+  battery.magic = BATTERY_MAGIC;
+}
+
 /**
- * Calculate the battery status (power level)
+ * Set up the ADC pin of the battery, once per wake and only when the battery is actually measured
+ */
+static void beginBatteryAdc() {
+  static bool started = false;
+  if (started)
+    return;
+
+  pinMode(BAT_ADC, ANALOG);
+  adcAttachPin(BAT_ADC);
+  analogReadResolution(12);
+  analogSetWidth(50);
+  started = true;
+}
+
+void sampleBattery() {
+  PROFILE_SCOPE(ProfileStage::BATTERY);
+  batteryBegin();
+  beginBatteryAdc();
+
+  uint32_t mv = 0;
+  for (uint8_t i = 0; i < BATTERY_SAMPLES; i++) {
+    mv += analogReadMilliVolts(BAT_ADC);
+  }
+  // The battery is measured behind a voltage divider
+  mv = mv * BATTERY_DIVIDER / BATTERY_SAMPLES;
+
+  if (battery.mvX16 == 0) {
+    battery.mvX16 = mv * 16;
+  } else {
+    battery.mvX16 += ((int32_t)(mv * 16) - (int32_t)battery.mvX16) / BATTERY_EMA_WEIGHT;
+  }
+}
+
+/**
+ * Percentage of the charge left for a battery voltage, interpolated on the discharge curve
  */
-int calculateBatteryStatus(Preferences *preferences) {
-  int bat = 0;
-  for (uint8_t i = 0; i < 25; i++) {
-    bat += analogRead(BAT_ADC);
+static int batteryLevel(uint32_t mv) {
+  const uint8_t points = sizeof(dischargeCurve) / sizeof(dischargeCurve[0]);
+  if (mv <= dischargeCurve[0].mv)
+    return 0;
+  for (uint8_t i = 1; i < points; i++) {
+    const BatteryPoint &low = dischargeCurve[i - 1];
+    const BatteryPoint &high = dischargeCurve[i];
+    if (mv < high.mv)
+      return low.level + (mv - low.mv) * (high.level - low.level) / (high.mv - low.mv);
   }
-  bat /= 25;
-  float volt = (bat * 3.3 / 4096);
+  return 100;
+}
 
-  int level = constrain(map(volt * 1000, 1630, 1850, 0, 100), 0, 100);
+/**
+ * Calculate the battery status (power level)
+ */
+int calculateBatteryStatus() {
+  sampleBattery();
+  int level = batteryLevel(battery.mvX16 / 16);
 
-  // Save the battery level to the preferences
-  preferences->putInt("battery_level", level);
+  // Save the battery level to the hot state
+  hotStateSetBatteryLevel(level);
+  log(LogLevel::INFO, (String("Battery ") + battery.mvX16 / 16 + " mV, " + level + "%, " + batteryRemainingHours() + " hours left").c_str());
 
   return level;
-}
\ No newline at end of file
+}
+
+void batteryAccountWake(uint32_t awakeUs, uint64_t sleepUs) {
+  batteryBegin();
+  uint64_t totalUs = awakeUs + sleepUs;
+  if (totalUs == 0)
+    return;
+
+  uint32_t currentUa = ((uint64_t)awakeUs * BATTERY_AWAKE_UA + sleepUs * BATTERY_SLEEP_UA) / totalUs;
+  if (battery.currentUa == 0) {
+    battery.currentUa = currentUa;
+  } else {
+    battery.currentUa += ((int32_t)currentUa - (int32_t)battery.currentUa) / BATTERY_EMA_WEIGHT;
+  }
+}
+
+int batteryRemainingHours() {
+  batteryBegin();
+  if (battery.currentUa == 0 || battery.mvX16 == 0)
+    return -1;
+  // uAh left / uA
+  return (uint32_t)batteryLevel(battery.mvX16 / 16) * BATTERY_CAPACITY_MAH * 10 / battery.currentUa;
+}
@@ -1,8 +1,31 @@
 #pragma once
 
 #include "Arduino.h"
+#include "hotstate.h"
+#include "log.h"
 #include "os_config.h"
-#include "Preferences.h"
+#include "profile.h"
+#include "rtcmagic.h"
 
+#define BATTERY_MAGIC      RTC_MAGIC('B', 'A', 'T', '1')
+// ADC readings per measurement, they are averaged over the wakes so a few are enough
+#define BATTERY_SAMPLES    4
+// Weight of the old average against a new measurement (exponential moving average)
+#define BATTERY_EMA_WEIGHT 8
 
-int calculateBatteryStatus(Preferences *preferences);
\ No newline at end of file
+/**
+ * Battery measurement
+ *
+ * Every wake reads the voltage a few times and folds it into an average in RTC memory, the level is looked up on
+ * the discharge curve of a LiPo from that average, so it does not jump around with the noise of the ADC. The time
+ * left is estimated from the average current, which is worked out from the awake and sleep time of the wakes.
+ */
+
+// Measure the battery voltage and add it to the average
+void sampleBattery();
+// Measure the battery and publish the level (%) to the hot state
+int calculateBatteryStatus();
+// Account a wake for the average current, call right before going to sleep
+void batteryAccountWake(uint32_t awakeUs, uint64_t sleepUs);
+// Hours until the battery is empty at the average current, -1 when there are no measurements yet
+int batteryRemainingHours();
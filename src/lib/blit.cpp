@@ -0,0 +1,63 @@
+#include "blit.h"
+
+void blitBitmap(GFXcanvas1 *canvas, int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+  if (canvas->getRotation() != 0) {
+    canvas->drawBitmap(x, y, bitmap, w, h, color);
+    return;
+  }
+  blitRaw(canvas->getBuffer(), canvas->width(), canvas->height(), x, y, bitmap, w, h, color);
+}
+
+void blitRaw(uint8_t *buffer, int16_t bufferWidth, int16_t bufferHeight, int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+             uint16_t color) {
+  const int16_t srcStride = (w + 7) / 8;
+  const int16_t dstStride = (bufferWidth + 7) / 8;
+
+  // Clip once for the whole bitmap
+  const int16_t x0 = max(x, (int16_t)0);
+  const int16_t x1 = min((int16_t)(x + w), bufferWidth);
+  const int16_t y0 = max(y, (int16_t)0);
+  const int16_t y1 = min((int16_t)(y + h), bufferHeight);
+  if (x0 >= x1 || y0 >= y1)
+    return;
+
+  const int16_t firstByte = x0 / 8;
+  const int16_t lastByte = (x1 - 1) / 8;
+
+  for (int16_t row = y0; row < y1; row++) {
+    const uint8_t *src = bitmap + (row - y) * srcStride;
+    uint8_t *dst = buffer + row * dstStride;
+
+    for (int16_t db = firstByte; db <= lastByte; db += 4) {
+      // Source bits for the destination bits db * 8 ... db * 8 + 31, the source byte k may be outside the bitmap
+      int16_t offset = db * 8 - x;
+      int16_t k = offset >> 3; // floor, offset is negative when x is not byte aligned
+      uint8_t shift = offset & 7;
+
+      uint64_t span = 0;
+      for (int16_t i = k; i < k + 5; i++) {
+        span <<= 8;
+        if (i >= 0 && i < srcStride)
+          span |= pgm_read_byte(src + i);
+      }
+      uint32_t bits = (uint32_t)(span >> (8 - shift));
+
+      // Drop the bits outside of the clipped area (and the padding at the end of the source row)
+      int16_t start = db * 8;
+      if (start < x0)
+        bits &= 0xFFFFFFFF >> (x0 - start);
+      if (start + 32 > x1)
+        bits &= 0xFFFFFFFF << (start + 32 - x1);
+
+      uint8_t bytes = min((int16_t)4, (int16_t)(lastByte - db + 1));
+      for (uint8_t i = 0; i < bytes; i++) {
+        uint8_t ink = bits >> (24 - i * 8);
+        if (color) {
+          dst[db + i] |= ink;
+        } else {
+          dst[db + i] &= ~ink;
+        }
+      }
+    }
+  }
+}
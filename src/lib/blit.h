@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "Arduino.h"
+
+// Draw a 1bpp bitmap in the drawBitmap() format (rows padded to whole bytes, MSB first, set bits are drawn
+// in color, cleared bits are left alone). With rotation 0 the bitmap is copied into the canvas buffer 32
+// pixels at a time, any other rotation goes through the generic (pixel by pixel) Adafruit_GFX::drawBitmap()
+void blitBitmap(GFXcanvas1 *canvas, int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color);
+
+// Copy a bitmap into a raw 1bpp buffer (GFXcanvas1 / GxEPD layout, 1 = white) of bufferWidth x bufferHeight
+// The clipping is worked out once, every row is then shifted into place a 32 bit word at a time
+void blitRaw(uint8_t *buffer, int16_t bufferWidth, int16_t bufferHeight, int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+             uint16_t color);
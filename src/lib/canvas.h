@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "Arduino.h"
+#include "blit.h"
+#include "os_config.h"
+
+/**
+ * 1bpp canvas with the rotation fixed at compile time
+ *
+ * GFXcanvas1 looks at the rotation (a switch and a coordinate swap) for every pixel it draws. The watch never
+ * changes its orientation, so here the rotation is a template parameter: the transform is resolved by the
+ * compiler and drawing a pixel is plain buffer indexing. Lines and rectangles are written as raw (panel) rows,
+ * a byte at a time, and bitmaps that were rotated at build time (tools/rotate_bitmaps.py) are copied as whole
+ * bytes.
+ *
+ * The buffer has the layout of GFXcanvas1 (and of the GxEPD buffer), getRotation() still reports ROTATION.
+ */
+template <uint8_t ROTATION> class RotatedCanvas : public GFXcanvas1 {
+  static_assert(ROTATION < 4, "Rotation has to be 0-3");
+
+public:
+  RotatedCanvas(uint16_t w, uint16_t h) : GFXcanvas1(w, h) { Adafruit_GFX::setRotation(ROTATION); }
+
+  // The rotation is part of the type and can not be changed
+  void setRotation(uint8_t r) override {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if ((x < 0) || (y < 0) || (x >= _width) || (y >= _height))
+      return;
+
+    int16_t w = 1;
+    int16_t h = 1;
+    toRaw(x, y, w, h);
+    uint8_t *ptr = getBuffer() + (x / 8) + y * rowBytes();
+    if (color)
+      *ptr |= 0x80 >> (x & 7);
+    else
+      *ptr &= ~(0x80 >> (x & 7));
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override { fillRect(x, y, 1, h, color); }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+    if (w < 0) {
+      x += w + 1;
+      w = -w;
+    }
+    if (h < 0) {
+      y += h + 1;
+      h = -h;
+    }
+
+    // Clip in logical coordinates
+    if (x < 0) {
+      w += x;
+      x = 0;
+    }
+    if (y < 0) {
+      h += y;
+      y = 0;
+    }
+    w = min(w, (int16_t)(_width - x));
+    h = min(h, (int16_t)(_height - y));
+    if (w <= 0 || h <= 0)
+      return;
+
+    toRaw(x, y, w, h);
+    for (int16_t row = y; row < y + h; row++) {
+      drawFastRawHLine(x, row, w, color);
+    }
+  }
+
+  // Draw a bitmap that was rotated for ROTATION by tools/rotate_bitmaps.py, w and h are the size on the screen
+  void drawRotatedBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) {
+    toRaw(x, y, w, h);
+    blitRaw(getBuffer(), WIDTH, HEIGHT, x, y, bitmap, w, h, color);
+  }
+
+private:
+  int16_t rowBytes() const { return (WIDTH + 7) / 8; }
+
+  // Logical rectangle -> raw (panel) rectangle, ROTATION is a constant so the switch is resolved by the compiler
+  void toRaw(int16_t &x, int16_t &y, int16_t &w, int16_t &h) const {
+    int16_t t;
+    switch (ROTATION) {
+    case 1:
+      t = x;
+      x = WIDTH - y - h;
+      y = t;
+      std::swap(w, h);
+      break;
+    case 2:
+      x = WIDTH - x - w;
+      y = HEIGHT - y - h;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - t - w;
+      std::swap(w, h);
+      break;
+    }
+  }
+};
+
+// The canvas the watch draws into
+typedef RotatedCanvas<DISPLAY_ROTATION> WatchCanvas;
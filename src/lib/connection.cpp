@@ -0,0 +1,179 @@
+#include "connection.h"
+
+struct WifiCache {
+  uint32_t magic;
+  uint8_t bssid[6];
+  uint8_t channel;
+};
+
+RTC_DATA_ATTR WifiCache wifiCache;
+// Failed sessions in a row, they set the backoff until the next session
+RTC_DATA_ATTR uint8_t wifiFailures = 0;
+
+// Set by the WiFi events, the connection code blocks on them
+#define WIFI_ASSOCIATED_BIT   (1 << 0)
+#define WIFI_GOT_IP_BIT       (1 << 1)
+#define WIFI_DISCONNECTED_BIT (1 << 2)
+
+static EventGroupHandle_t wifiEvents = NULL;
+static uint32_t wifiAssociatedUs = 0;
+
+static void onWifiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+  switch (event) {
+  case ARDUINO_EVENT_WIFI_STA_CONNECTED:
+    wifiAssociatedUs = micros();
+    xEventGroupSetBits(wifiEvents, WIFI_ASSOCIATED_BIT);
+    break;
+  case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+    xEventGroupSetBits(wifiEvents, WIFI_GOT_IP_BIT);
+    break;
+  case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+    xEventGroupSetBits(wifiEvents, WIFI_DISCONNECTED_BIT);
+    break;
+  default:
+    break;
+  }
+}
+
+/**
+ * The cached access point, from NVS when the RTC memory was lost
+ */
+static bool loadWifiCache(Preferences *preferences) {
+  if (wifiCache.magic == WIFI_CACHE_MAGIC)
+    return true;
+
+  PROFILE_SCOPE(ProfileStage::NVS_READ);
+  if (preferences->getBytes("wifi_cache", &wifiCache, sizeof(wifiCache)) != sizeof(wifiCache) || wifiCache.magic != WIFI_CACHE_MAGIC) {
+    wifiCache.magic = 0;
+    return false;
+  }
+  return true;
+}
+
+static void saveWifiCache(Preferences *preferences) {
+  WifiCache cache;
+  memset(&cache, 0, sizeof(cache));
+  cache.magic = WIFI_CACHE_MAGIC;
+  memcpy(cache.bssid, WiFi.BSSID(), sizeof(cache.bssid));
+  cache.channel = WiFi.channel();
+
+  // Only write to flash when the network changed
+  if (memcmp(&cache, &wifiCache, sizeof(cache)) == 0)
+    return;
+  wifiCache = cache;
+  PROFILE_SCOPE(ProfileStage::NVS_WRITE);
+  preferences->putBytes("wifi_cache", &wifiCache, sizeof(wifiCache));
+}
+
+/**
+ * Start connecting and block until we have an IP, the access point turned us down or the time is up
+ * The task sleeps meanwhile, the time to associate and the time to get the IP are recorded separately
+ */
+static bool connect(const String &ssid, const String &password, int32_t channel, const uint8_t *bssid, uint32_t timeoutMs) {
+  xEventGroupClearBits(wifiEvents, WIFI_ASSOCIATED_BIT | WIFI_GOT_IP_BIT | WIFI_DISCONNECTED_BIT);
+  uint32_t start = micros();
+  WiFi.begin(ssid.c_str(), password.c_str(), channel, bssid);
+
+  EventBits_t bits = xEventGroupWaitBits(wifiEvents, WIFI_GOT_IP_BIT | WIFI_DISCONNECTED_BIT, pdFALSE, pdFALSE, pdMS_TO_TICKS(timeoutMs));
+  if (bits & WIFI_ASSOCIATED_BIT) {
+    profileAdd(ProfileStage::WIFI_CONNECT, wifiAssociatedUs - start);
+    if (bits & WIFI_GOT_IP_BIT)
+      profileAdd(ProfileStage::WIFI_IP, micros() - wifiAssociatedUs);
+  }
+  if (bits & WIFI_GOT_IP_BIT)
+    return true;
+
+  log(LogLevel::WARNING, bits & WIFI_DISCONNECTED_BIT ? "WiFi connection refused" : "WiFi connection timed out");
+  WiFi.disconnect();
+  return false;
+}
+
+/**
+ * Straight to the cached access point, no scan
+ * The IP still comes from DHCP: a static copy of an old lease can be handed to another host by now
+ */
+static bool connectCached(const String &ssid, const String &password) {
+  WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  return connect(ssid, password, wifiCache.channel, wifiCache.bssid, WIFI_FAST_TIMEOUT_MS);
+}
+
+/**
+ * Scan for the strongest access point of the network and connect to it using DHCP
+ */
+static bool connectScanned(const String &ssid, const String &password, uint32_t timeoutMs) {
+  int best = -1;
+  {
+    PROFILE_SCOPE(ProfileStage::WIFI_SCAN);
+    int n = WiFi.scanNetworks(false, false, false, WIFI_SCAN_CHANNEL_MS, 0, ssid.c_str());
+    for (int i = 0; i < n; i++) {
+      if (WiFi.SSID(i) == ssid && (best < 0 || WiFi.RSSI(i) > WiFi.RSSI(best)))
+        best = i;
+    }
+    log(LogLevel::INFO, (String(n < 0 ? 0 : n) + " access points of " + ssid + " found").c_str());
+  }
+
+  WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  // Hidden networks do not show up in the scan, then finding it is left to the driver
+  int32_t channel = best >= 0 ? WiFi.channel(best) : 0;
+  uint8_t bssid[6];
+  if (best >= 0)
+    memcpy(bssid, WiFi.BSSID(best), sizeof(bssid));
+  WiFi.scanDelete();
+  return connect(ssid, password, channel, best >= 0 ? bssid : NULL, timeoutMs);
+}
+
+/**
+ * Remember how the session went, failures in a row double the time until the next session
+ */
+static bool sessionDone(bool connected) {
+  wifiFailures = connected ? 0 : min(wifiFailures + 1, 16);
+  return connected;
+}
+
+void wifiForget(Preferences *preferences) {
+  if (!loadWifiCache(preferences))
+    return;
+  wifiCache.magic = 0;
+  PROFILE_SCOPE(ProfileStage::NVS_WRITE);
+  preferences->remove("wifi_cache");
+}
+
+uint32_t wifiBackoffS() {
+  if (wifiFailures == 0)
+    return 0;
+  return min((uint32_t)WIFI_BACKOFF_BASE_S << min(wifiFailures - 1, 16), (uint32_t)WIFI_BACKOFF_MAX_S);
+}
+
+bool wifiConnect(Preferences *preferences, const String &ssid, const String &password) {
+  if (wifiEvents == NULL) {
+    wifiEvents = xEventGroupCreate();
+    WiFi.onEvent(onWifiEvent);
+  }
+  uint32_t start = millis();
+
+  // The configuration that works on this device, the low transmit power is REQUIRED otherwise WiFi does not work!
+  // Reconnecting is up to us (and the backoff), not to the driver
+  WiFi.mode(WIFI_STA);
+  WiFi.setAutoReconnect(false);
+  WiFi.persistent(false);
+  WiFi.setTxPower(WIFI_POWER_2dBm);
+  WiFi.hostname("LilyPaperWatch");
+
+  if (loadWifiCache(preferences)) {
+    if (connectCached(ssid, password)) {
+      log(LogLevel::SUCCESS, "WiFi connected to the cached access point");
+      return sessionDone(true);
+    }
+    log(LogLevel::WARNING, "Cached access point failed, scanning");
+    // Also from NVS, otherwise it would be tried first again after every power loss
+    wifiForget(preferences);
+  }
+
+  // Whatever is left of the session
+  uint32_t elapsed = millis() - start;
+  if (elapsed >= WIFI_SESSION_TIMEOUT_MS || !connectScanned(ssid, password, WIFI_SESSION_TIMEOUT_MS - elapsed))
+    return sessionDone(false);
+
+  saveWifiCache(preferences);
+  return sessionDone(true);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "WiFi.h"
+#include "log.h"
+#include "os_config.h"
+#include "profile.h"
+#include "rtcmagic.h"
+
+#define WIFI_CACHE_MAGIC        RTC_MAGIC('W', 'I', 'F', '2')
+// A fast connect to the cached access point is given up after this, then we scan
+#define WIFI_FAST_TIMEOUT_MS    5000
+// Hard limit for a session, the fast connect, the scan and the connect after the scan together
+#define WIFI_SESSION_TIMEOUT_MS 15000
+// Dwell time per channel of the scan
+#define WIFI_SCAN_CHANNEL_MS    120
+// After a failed session the next one is this much later, doubling with every failure in a row up to the max
+#define WIFI_BACKOFF_BASE_S     (30 * 60)
+#define WIFI_BACKOFF_MAX_S      (24 * 3600)
+
+/**
+ * WiFi connection with a cached access point
+ *
+ * A scan of all channels takes seconds of radio time. After a successful connection the BSSID and the channel are
+ * kept in RTC memory (and in NVS for after a power loss), the next connection goes straight to that access point.
+ * Only when that fails the channels are scanned for the strongest access point of the network, the result replaces
+ * the cache.
+ *
+ * The connection is driven by the WiFi events: the task sleeps until it has an IP, is turned down or the session
+ * is over. The failed sessions in a row are counted in RTC memory, the caller waits wifiBackoffS() before the next
+ * one, so a network that is not there costs one short session per backoff interval.
+ */
+
+// Connect to the network, returns false when it did not work out within the timeouts
+bool wifiConnect(Preferences *preferences, const String &ssid, const String &password);
+// Drop the cached access point (RTC and NVS), the next connection scans again
+// For a session that connected but could not reach anything
+void wifiForget(Preferences *preferences);
+// Seconds to wait before the next session after the failures so far, 0 after a success
+uint32_t wifiBackoffS();
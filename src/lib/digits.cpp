@@ -0,0 +1,101 @@
+#include "digits.h"
+
+// The sprites are rotated for the display orientation used by the watch
+#define DIGIT_SPRITE_ROTATION 1
+
+static const DigitSprite *digitSprite(const DigitSpriteFont *sprites, char c) {
+  if (c >= '0' && c <= '9')
+    return &sprites->sprites[c - '0'];
+  if (c == ':')
+    return &sprites->sprites[10];
+  return NULL;
+}
+
+/**
+ * Copy the sprites of buf into the canvas with the cursor at x (logical coordinates)
+ * Returns false without drawing anything when the string can not be drawn with sprites
+ */
+static bool blitDigits(GFXcanvas1 *canvas, const DigitSpriteFont *sprites, const char *buf, int x, int y) {
+  if (canvas->getRotation() != DIGIT_SPRITE_ROTATION)
+    return false;
+
+  // Raw (unrotated) canvas size, in rotation 1 the logical height is the raw width
+  const int16_t rawWidth = canvas->height();
+  const int16_t rawHeight = canvas->width();
+  const uint16_t rowStride = (rawWidth + 7) / 8;
+
+  // Logical y -> raw x, the first sprite bit is the lowest row of the glyph line
+  int16_t rawX = rawWidth - 1 - (y + sprites->descent);
+  if (rawX < 0)
+    return false;
+  uint8_t shift = rawX & 7;
+  uint16_t firstByte = rawX / 8;
+  if (firstByte + sprites->rowBytes + (shift ? 1 : 0) > rowStride)
+    return false;
+
+  // Check everything first, we either draw all of it or nothing
+  int16_t cursor = x;
+  for (const char *c = buf; *c; c++) {
+    const DigitSprite *sprite = digitSprite(sprites, *c);
+    if (!sprite)
+      return false;
+    int16_t rawY = cursor + (int8_t)pgm_read_byte(&sprite->xOffset);
+    if (rawY < 0 || rawY + pgm_read_byte(&sprite->width) > rawHeight)
+      return false;
+    cursor += pgm_read_byte(&sprite->xAdvance);
+  }
+
+  uint8_t *buffer = canvas->getBuffer();
+  const uint8_t *bitmap = sprites->bitmap;
+  cursor = x;
+  for (const char *c = buf; *c; c++) {
+    const DigitSprite *sprite = digitSprite(sprites, *c);
+    const uint8_t *src = bitmap + pgm_read_word(&sprite->bitmapOffset);
+    uint8_t width = pgm_read_byte(&sprite->width);
+    // Logical x -> raw y, every glyph column is one row of the canvas
+    uint8_t *dst = buffer + (cursor + (int8_t)pgm_read_byte(&sprite->xOffset)) * rowStride + firstByte;
+
+    for (uint8_t column = 0; column < width; column++) {
+      // Set bits in the sprite are ink, ink is black (a cleared bit) in the canvas
+      if (shift == 0) {
+        for (uint8_t i = 0; i < sprites->rowBytes; i++) {
+          dst[i] &= ~pgm_read_byte(src++);
+        }
+      } else {
+        for (uint8_t i = 0; i < sprites->rowBytes; i++) {
+          uint8_t ink = pgm_read_byte(src++);
+          dst[i] &= ~(ink >> shift);
+          dst[i + 1] &= ~(ink << (8 - shift));
+        }
+      }
+      dst += rowStride;
+    }
+    cursor += pgm_read_byte(&sprite->xAdvance);
+  }
+
+  return true;
+}
+
+void printCenterDigits(GFXcanvas1 *canvas, const DigitSpriteFont *sprites, const RleFont *font, const char *buf, int x, int y) {
+  // Same width as TextRun gives for the GFX font
+  int16_t cursor = 0;
+  int16_t minx = 0x7FFF;
+  int16_t maxx = -1;
+  for (const char *c = buf; *c; c++) {
+    const DigitSprite *sprite = digitSprite(sprites, *c);
+    if (!sprite) {
+      minx = 0x7FFF;
+      break;
+    }
+    int16_t x1 = cursor + (int8_t)pgm_read_byte(&sprite->xOffset);
+    int16_t x2 = x1 + pgm_read_byte(&sprite->width) - 1;
+    minx = min(minx, x1);
+    maxx = max(maxx, x2);
+    cursor += pgm_read_byte(&sprite->xAdvance);
+  }
+
+  if (maxx >= minx && blitDigits(canvas, sprites, buf, x - (uint16_t)(maxx - minx + 1) / 2, y))
+    return;
+
+  printCenterString(canvas, font, buf, x, y, GxEPD_BLACK);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "Arduino.h"
+#include "ui.h"
+
+// Pre-rasterized clock glyph, see tools/gen_digit_sprites.py
+struct DigitSprite {
+  uint16_t bitmapOffset; // Pointer into DigitSpriteFont->bitmap
+  uint8_t width;         // Glyph columns (= sprite rows)
+  uint8_t xAdvance;      // Distance to advance cursor (x axis)
+  int8_t xOffset;        // X dist from cursor pos to the first column
+};
+
+// Sprites for '0'-'9' and ':' of one font
+struct DigitSpriteFont {
+  uint8_t *bitmap;      // Sprite rows, concatenated
+  DigitSprite *sprites; // '0'-'9' followed by ':'
+  uint8_t rowBytes;     // Bytes per sprite row
+  int8_t descent;       // Pixels below the baseline covered by a sprite row
+};
+
+// Draw a string of digits and ':' centered at x, the same way printCenterString() draws it with the GFX font
+// The sprites are copied straight into the canvas buffer (black on the existing background), anything the
+// sprites can not draw (other rotations, characters or the screen edges) falls back to the GFX font
+void printCenterDigits(GFXcanvas1 *canvas, const DigitSpriteFont *sprites, const RleFont *font, const char *buf, int x, int y);
@@ -0,0 +1,132 @@
+#include "forecast.h"
+#include "hotstate.h"
+#include "log.h"
+#include "profile.h"
+
+struct ForecastCondition {
+  uint16_t code;
+  const char *text;
+};
+
+// The condition codes of weatherapi.com with their texts (in English, which is what the display shows)
+static const ForecastCondition forecastConditions[] = {
+    {1000, "Sunny"},
+    {1003, "Partly cloudy"},
+    {1006, "Cloudy"},
+    {1009, "Overcast"},
+    {1030, "Mist"},
+    {1063, "Patchy rain possible"},
+    {1066, "Patchy snow possible"},
+    {1069, "Patchy sleet possible"},
+    {1072, "Patchy freezing drizzle possible"},
+    {1087, "Thundery outbreaks possible"},
+    {1114, "Blowing snow"},
+    {1117, "Blizzard"},
+    {1135, "Fog"},
+    {1147, "Freezing fog"},
+    {1150, "Patchy light drizzle"},
+    {1153, "Light drizzle"},
+    {1168, "Freezing drizzle"},
+    {1171, "Heavy freezing drizzle"},
+    {1180, "Patchy light rain"},
+    {1183, "Light rain"},
+    {1186, "Moderate rain at times"},
+    {1189, "Moderate rain"},
+    {1192, "Heavy rain at times"},
+    {1195, "Heavy rain"},
+    {1198, "Light freezing rain"},
+    {1201, "Moderate or heavy freezing rain"},
+    {1204, "Light sleet"},
+    {1207, "Moderate or heavy sleet"},
+    {1210, "Patchy light snow"},
+    {1213, "Light snow"},
+    {1216, "Patchy moderate snow"},
+    {1219, "Moderate snow"},
+    {1222, "Patchy heavy snow"},
+    {1225, "Heavy snow"},
+    {1237, "Ice pellets"},
+    {1240, "Light rain shower"},
+    {1243, "Moderate or heavy rain shower"},
+    {1246, "Torrential rain shower"},
+    {1249, "Light sleet showers"},
+    {1252, "Moderate or heavy sleet showers"},
+    {1255, "Light snow showers"},
+    {1258, "Moderate or heavy snow showers"},
+    {1261, "Light showers of ice pellets"},
+    {1264, "Moderate or heavy showers of ice pellets"},
+    {1273, "Patchy light rain with thunder"},
+    {1276, "Moderate or heavy rain with thunder"},
+    {1279, "Patchy light snow with thunder"},
+    {1282, "Moderate or heavy snow with thunder"},
+};
+
+struct ForecastState {
+  uint32_t magic;
+  uint32_t shownHour; // Hour whose weather the hot state has, nothing is done until the next one
+  uint8_t count;
+  ForecastHour hours[FORECAST_HOURS];
+};
+
+RTC_DATA_ATTR ForecastState forecast;
+
+/**
+ * The forecast, from NVS when the RTC memory was lost
+ */
+static bool forecastLoad(Preferences *preferences) {
+  if (forecast.magic == FORECAST_MAGIC)
+    return true;
+
+  PROFILE_SCOPE(ProfileStage::NVS_READ);
+  if (preferences->getBytes("forecast", &forecast, sizeof(forecast)) != sizeof(forecast) || forecast.magic != FORECAST_MAGIC ||
+      forecast.count > FORECAST_HOURS) {
+    memset(&forecast, 0, sizeof(forecast));
+    forecast.magic = FORECAST_MAGIC;
+    return false;
+  }
+  return true;
+}
+
+void forecastStore(Preferences *preferences, const ForecastHour *hours, uint8_t count, time_t now) {
+  forecast.magic = FORECAST_MAGIC;
+  forecast.shownHour = now / 3600;
+  forecast.count = min(count, (uint8_t)FORECAST_HOURS);
+  memcpy(forecast.hours, hours, forecast.count * sizeof(ForecastHour));
+
+  // Once per WiFi session, the NVS copy only matters after a power loss
+  PROFILE_SCOPE(ProfileStage::NVS_WRITE);
+  preferences->putBytes("forecast", &forecast, sizeof(forecast));
+}
+
+void forecastUpdateWeather(Preferences *preferences, time_t now) {
+  uint32_t hour = now / 3600;
+  if (forecast.magic == FORECAST_MAGIC && forecast.shownHour == hour)
+    return;
+  if (!forecastLoad(preferences) || forecast.shownHour == hour)
+    return;
+  forecast.shownHour = hour;
+
+  for (uint8_t i = 0; i < forecast.count; i++) {
+    const ForecastHour &entry = forecast.hours[i];
+    const char *text = forecastConditionText(entry.condition);
+    if (entry.hour != hour || text == NULL)
+      continue;
+
+    char temp[HOT_STATE_TEMP_SIZE];
+    int deci = entry.tempDeciCelsius;
+    snprintf(temp, sizeof(temp), "%s%d.%d", deci < 0 ? "-" : "", abs(deci) / 10, abs(deci) % 10);
+    hotStateSetWeather(text, temp);
+    return;
+  }
+  log(LogLevel::WARNING, "No forecast for this hour");
+}
+
+const char *forecastConditionText(uint16_t condition) {
+  uint16_t code = condition & ~FORECAST_NIGHT_BIT;
+  if (code == 1000 && (condition & FORECAST_NIGHT_BIT))
+    return "Clear";
+  for (const ForecastCondition &known : forecastConditions) {
+    if (known.code == code)
+      return known.text;
+  }
+  return NULL;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "os_config.h"
+#include "rtcmagic.h"
+
+// Hours of forecast kept, one WiFi session covers the day after it
+#define FORECAST_HOURS     24
+#define FORECAST_MAGIC     RTC_MAGIC('F', 'C', 'S', '1')
+// Set in the condition code of the night hours, the sunny hours are "Clear" at night
+#define FORECAST_NIGHT_BIT 0x8000
+
+// One hour of the forecast, 8 bytes
+struct __attribute__((packed)) ForecastHour {
+  uint32_t hour;           // Hours since the epoch (UTC)
+  uint16_t condition;      // Condition code of the weather API, FORECAST_NIGHT_BIT for the night hours
+  int16_t tempDeciCelsius; // Temperature in 0.1 °C
+};
+
+/**
+ * Hourly forecast for the hours between the WiFi sessions
+ *
+ * The weather is only fetched every few hours, the current conditions of a fetch go stale long before the next one.
+ * Every fetch brings the forecast for the next FORECAST_HOURS hours along, it is kept as a compact array in RTC
+ * memory (and in NVS for after a power loss), and every wake in a new hour shows the entry for that hour. The
+ * condition texts come from a table of the API's condition codes, so the store holds no strings.
+ */
+
+// Replace the forecast with the hours of a fetch, the current hour shows the current conditions of the fetch
+void forecastStore(Preferences *preferences, const ForecastHour *hours, uint8_t count, time_t now);
+// Publish the forecast of the current hour to the hot state, when the hour changed since the last time
+void forecastUpdateWeather(Preferences *preferences, time_t now);
+// The text of a condition code (with FORECAST_NIGHT_BIT), NULL for codes the table does not know
+const char *forecastConditionText(uint16_t condition);
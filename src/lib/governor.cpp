@@ -0,0 +1,102 @@
+#include "governor.h"
+
+static const uint16_t governorMhz[GOVERNOR_FREQUENCIES] = {240, 160, 80, 40};
+// Current of the chip at each frequency with one core busy and the radio off, from the ESP32 datasheet
+static const uint16_t governorMa[GOVERNOR_FREQUENCIES] = {50, 40, 30, 20};
+
+// Index into governorMhz per phase: short bursts for the CPU bound work, low clocks for the waits
+static const uint8_t governorPolicy[] = {
+    0, // RENDER 240 MHz
+    2, // EPD 80 MHz
+    2, // PARSE 80 MHz, the base frequency of the network session
+};
+
+static_assert(sizeof(governorPolicy) == (uint8_t)CpuPhase::COUNT, "Every phase needs a policy");
+
+static const char *governorPhaseNames[] = {"render", "epd", "parse"};
+
+struct GovernorStats {
+  uint32_t magic;
+  uint32_t wakes;
+  uint32_t count[(uint8_t)CpuPhase::COUNT][GOVERNOR_FREQUENCIES];
+  uint32_t totalUs[(uint8_t)CpuPhase::COUNT][GOVERNOR_FREQUENCIES];
+};
+
+// In slow RTC memory, which both cores can reach: parse runs in the network task on core 0, the others on core 1
+RTC_DATA_ATTR GovernorStats governorStats;
+
+static volatile bool governorPinned = false;
+
+static void setMhz(uint32_t mhz) {
+  if (getCpuFrequencyMhz() != mhz)
+    setCpuFrequencyMhz(mhz);
+}
+
+void governorBegin() {
+  if (governorStats.magic != GOVERNOR_MAGIC) {
+    memset(&governorStats, 0, sizeof(governorStats));
+    governorStats.magic = GOVERNOR_MAGIC;
+  }
+  governorStats.wakes++;
+  setMhz(GOVERNOR_BASE_MHZ);
+}
+
+CpuPhaseScope::CpuPhaseScope(CpuPhase phase) : _phase(phase), _switched(!governorPinned), _previousMhz(getCpuFrequencyMhz()) {
+  if (!_switched) {
+    // Recorded at the frequency it runs at
+    _frequency = 2;
+    for (uint8_t f = 0; f < GOVERNOR_FREQUENCIES; f++) {
+      if (governorMhz[f] == _previousMhz)
+        _frequency = f;
+    }
+    _start = micros();
+    return;
+  }
+
+#if ENABLE_GOVERNOR_SWEEP
+  _frequency = governorStats.wakes % GOVERNOR_FREQUENCIES;
+#else
+  _frequency = governorPolicy[(uint8_t)phase];
+#endif
+  setMhz(governorMhz[_frequency]);
+  _start = micros();
+}
+
+CpuPhaseScope::~CpuPhaseScope() {
+  if (governorStats.magic == GOVERNOR_MAGIC) {
+    uint32_t &count = governorStats.count[(uint8_t)_phase][_frequency];
+    uint32_t &totalUs = governorStats.totalUs[(uint8_t)_phase][_frequency];
+    // Halving both keeps the mean and makes room, the old samples weigh less from then on
+    if (totalUs >= 0x80000000u) {
+      count = (count + 1) / 2;
+      totalUs /= 2;
+    }
+    count++;
+    totalUs += micros() - _start;
+  }
+  if (_switched)
+    setMhz(_previousMhz);
+}
+
+void governorPin(bool pinned) { governorPinned = pinned; }
+
+void governorDump() {
+  if (governorStats.magic != GOVERNOR_MAGIC) {
+    Serial.println("No phases recorded");
+    return;
+  }
+
+  // Charge in uC (mA * ms), the number to minimise
+  Serial.printf("CPU phases over %lu wakes\n", (unsigned long)governorStats.wakes);
+  Serial.printf("%-8s %5s %5s %10s %10s\n", "phase", "MHz", "n", "mean us", "mean uC");
+  for (uint8_t phase = 0; phase < (uint8_t)CpuPhase::COUNT; phase++) {
+    for (uint8_t f = 0; f < GOVERNOR_FREQUENCIES; f++) {
+      uint32_t n = governorStats.count[phase][f];
+      if (n == 0)
+        continue;
+      uint32_t meanUs = governorStats.totalUs[phase][f] / n;
+      Serial.printf("%-8s %5d %5lu %10lu %10lu\n", governorPhaseNames[phase], governorMhz[f], (unsigned long)n, (unsigned long)meanUs,
+                    (unsigned long)(meanUs * governorMa[f] / 1000));
+    }
+  }
+}
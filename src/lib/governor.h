@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Arduino.h"
+#include "os_config.h"
+#include "rtcmagic.h"
+
+// CPU frequency outside of the phases below
+#define GOVERNOR_BASE_MHZ    80
+// Frequencies the governor can pick from
+#define GOVERNOR_FREQUENCIES 4
+#define GOVERNOR_MAGIC       RTC_MAGIC('G', 'V', 'N', '2')
+
+// The parts of a wake with a different bottleneck, each runs at the frequency the policy picks for it
+// The network session pins the base frequency (the radio needs at least 80 MHz), so its phases are only recorded
+enum class CpuPhase : uint8_t {
+  RENDER, // Drawing into the canvas, CPU bound
+  EPD,    // Pushing frames to the panel: SPI transfer and waiting for the busy pin (both inside GxEPD)
+  PARSE,  // Parsing the weather JSON as it arrives, in the network session
+  COUNT
+};
+
+// Start the wake at the base frequency
+void governorBegin();
+// Print the time and the estimated charge of every phase at every frequency
+void governorDump();
+// Keep the frequency as it is while phases run on both cores (the frequency is global, the scopes would undo each other)
+void governorPin(bool pinned);
+
+/**
+ * Runs the scope it lives in at the frequency of a phase, and restores the previous frequency when it ends
+ *
+ * The time spent in the phase is recorded per frequency in RTC memory. With ENABLE_GOVERNOR_SWEEP every wake runs the
+ * render and EPD phases at the next frequency of the list instead of the policy, so after a few wakes governorDump()
+ * shows which frequency takes the least charge for each of them. Parse only ever shows up at the base frequency.
+ *
+ * The frequency is set with setCpuFrequencyMhz() directly, so esp_pm must stay unconfigured: power management keeps
+ * its own record of the CPU and APB clocks and would disagree with the real ones after a switch.
+ */
+class CpuPhaseScope {
+public:
+  CpuPhaseScope(CpuPhase phase);
+  ~CpuPhaseScope();
+
+private:
+  CpuPhase _phase;
+  uint8_t _frequency; // Index into the frequency list
+  bool _switched;     // The frequency was changed for the phase, it is restored at the end
+  uint32_t _previousMhz;
+  uint32_t _start;
+};
+
+#define CPU_PHASE_CONCAT_(a, b) a##b
+#define CPU_PHASE_CONCAT(a, b)  CPU_PHASE_CONCAT_(a, b)
+#define CPU_PHASE(phase)        CpuPhaseScope CPU_PHASE_CONCAT(cpuPhase, __LINE__)(phase)
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <stdint.h>
+
+// FNV-1a of a string, tells the cached entries of different hosts and URLs apart without storing them
+inline uint32_t fnv1a(const char *text) {
+  uint32_t hash = 2166136261u;
+  for (; *text; text++)
+    hash = (hash ^ (uint8_t)*text) * 16777619u;
+  return hash;
+}
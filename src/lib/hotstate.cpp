@@ -0,0 +1,77 @@
+#include "hotstate.h"
+#include "log.h"
+#include "rom/crc.h"
+
+RTC_DATA_ATTR HotState hot;
+
+static uint32_t hotStateChecksum() {
+  return crc32_le(0, (const uint8_t *)&hot + sizeof(hot.checksum), sizeof(HotState) - sizeof(hot.checksum));
+}
+
+static void hotStateChanged() {
+  hot.dirty = 1;
+  hot.checksum = hotStateChecksum();
+}
+
+static void copyText(char *dest, size_t size, const String &text) {
+  strncpy(dest, text.c_str(), size - 1);
+  dest[size - 1] = '\0';
+}
+
+void hotStateBegin(Preferences *preferences) {
+  if (hot.version == HOT_STATE_VERSION && hot.checksum == hotStateChecksum())
+    return;
+
+  log(LogLevel::WARNING, "No valid state in RTC memory, loading the checkpoint");
+  PROFILE_SCOPE(ProfileStage::NVS_READ);
+  memset(&hot, 0, sizeof(hot));
+  hot.version = HOT_STATE_VERSION;
+  hot.prevTimeUnix = preferences->getLong64("prev_time_unix", 0);
+  hot.focusTime = preferences->getInt("focus_time", 0);
+  hot.batteryLevel = preferences->getInt("battery_level", 0);
+  copyText(hot.weatherCondition, sizeof(hot.weatherCondition), preferences->getString("weather_c"));
+  copyText(hot.weatherTemp, sizeof(hot.weatherTemp), preferences->getString("weather_t"));
+  hot.checksum = hotStateChecksum();
+}
+
+const HotState &hotState() { return hot; }
+
+void hotStateSetTime(int64_t prevTimeUnix) {
+  hot.prevTimeUnix = prevTimeUnix;
+  hotStateChanged();
+}
+
+void hotStateSetFocusTime(int focusTime) {
+  if (hot.focusTime == focusTime)
+    return;
+  hot.focusTime = focusTime;
+  hotStateChanged();
+}
+
+void hotStateSetBatteryLevel(int batteryLevel) {
+  if (hot.batteryLevel == batteryLevel)
+    return;
+  hot.batteryLevel = batteryLevel;
+  hotStateChanged();
+}
+
+void hotStateSetWeather(const String &condition, const String &temp) {
+  copyText(hot.weatherCondition, sizeof(hot.weatherCondition), condition);
+  copyText(hot.weatherTemp, sizeof(hot.weatherTemp), temp);
+  hotStateChanged();
+}
+
+void hotStateCheckpoint(Preferences *preferences) {
+  if (!hot.dirty)
+    return;
+
+  PROFILE_SCOPE(ProfileStage::NVS_WRITE);
+  preferences->putLong64("prev_time_unix", hot.prevTimeUnix);
+  preferences->putInt("focus_time", hot.focusTime);
+  preferences->putInt("battery_level", hot.batteryLevel);
+  preferences->putString("weather_c", hot.weatherCondition);
+  preferences->putString("weather_t", hot.weatherTemp);
+  hot.dirty = 0;
+  hot.checksum = hotStateChecksum();
+  log(LogLevel::INFO, "State checkpointed to NVS");
+}
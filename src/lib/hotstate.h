@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "os_config.h"
+#include "profile.h"
+
+// Layout version of HotState, bump it when the struct changes so that an old copy in RTC memory is not picked up
+#define HOT_STATE_VERSION      1
+#define HOT_STATE_WEATHER_SIZE 48 // Longest condition text of the weather API is ~40 characters
+#define HOT_STATE_TEMP_SIZE    8
+
+/**
+ * The values that change (or are read) on every wake
+ *
+ * They used to live in the preferences only, every minute cost a few NVS reads and writes (milliseconds each,
+ * and flash wear). Now RTC memory holds the live copy, protected by a version and a checksum, and NVS is only a
+ * checkpoint: written by hotStateCheckpoint() on a schedule, on low battery and before an interactive wake, and
+ * read only when the RTC copy is lost (power loss) or of another version.
+ */
+struct __attribute__((packed)) HotState {
+  uint32_t checksum; // Of the fields below
+  uint8_t version;
+  uint8_t dirty;                                 // Changed since the last checkpoint
+  int64_t prevTimeUnix;                          // "prev_time_unix", the time to continue from after a power loss
+  int16_t focusTime;                             // "focus_time"
+  uint8_t batteryLevel;                          // "battery_level"
+  char weatherCondition[HOT_STATE_WEATHER_SIZE]; // "weather_c"
+  char weatherTemp[HOT_STATE_TEMP_SIZE];         // "weather_t"
+};
+
+// Load the hot values, from the NVS checkpoint when the copy in RTC memory is not valid
+void hotStateBegin(Preferences *preferences);
+// The hot values, change them with the setters below so that the checksum stays valid
+const HotState &hotState();
+
+void hotStateSetTime(int64_t prevTimeUnix);
+void hotStateSetFocusTime(int focusTime);
+void hotStateSetBatteryLevel(int batteryLevel);
+void hotStateSetWeather(const String &condition, const String &temp);
+
+// Write the values that changed since the last checkpoint to NVS
+void hotStateCheckpoint(Preferences *preferences);
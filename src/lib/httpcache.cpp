@@ -0,0 +1,95 @@
+#include "httpcache.h"
+#include "hash.h"
+#include "log.h"
+#include "profile.h"
+
+const char *httpCacheHeaders[4] = {"ETag", "Last-Modified", "Cache-Control", "Age"};
+
+struct HttpCacheEntry {
+  uint32_t magic;
+  uint32_t urlHash; // The entry is for this URL only, another location or key starts over
+  int64_t expires;  // System time (s since the epoch) until which the response is fresh, 0 when it is not
+  char etag[HTTP_CACHE_ETAG_SIZE];
+  char lastModified[HTTP_CACHE_DATE_SIZE];
+};
+
+RTC_DATA_ATTR HttpCacheEntry httpCache;
+
+/**
+ * The entry for the URL, from NVS when the RTC memory was lost, NULL when there is none
+ */
+static const HttpCacheEntry *httpCacheEntry(Preferences *preferences, const char *url) {
+  if (httpCache.magic != HTTP_CACHE_MAGIC) {
+    PROFILE_SCOPE(ProfileStage::NVS_READ);
+    if (preferences->getBytes("http_cache", &httpCache, sizeof(httpCache)) != sizeof(httpCache) || httpCache.magic != HTTP_CACHE_MAGIC) {
+      memset(&httpCache, 0, sizeof(httpCache));
+      httpCache.magic = HTTP_CACHE_MAGIC;
+    }
+  }
+  return httpCache.urlHash == fnv1a(url) ? &httpCache : NULL;
+}
+
+static void copyHeader(char *field, size_t size, const String &value) {
+  // Cut off validators would never match, rather have none
+  if (value.length() >= size)
+    field[0] = '\0';
+  else
+    strcpy(field, value.c_str());
+}
+
+long httpCacheMaxAge(const char *cacheControl) {
+  long maxAge = -1;
+  for (const char *p = cacheControl; *p;) {
+    while (*p == ' ' || *p == ',')
+      p++;
+    if (strncasecmp(p, "no-store", 8) == 0)
+      return -1;
+    if (strncasecmp(p, "no-cache", 8) == 0)
+      maxAge = 0;
+    else if (strncasecmp(p, "max-age=", 8) == 0 && maxAge != 0)
+      maxAge = atol(p + 8);
+    while (*p && *p != ',')
+      p++;
+  }
+  return maxAge;
+}
+
+bool httpCacheFresh(Preferences *preferences, const char *url, time_t now) {
+  const HttpCacheEntry *entry = httpCacheEntry(preferences, url);
+  return entry != NULL && now < entry->expires;
+}
+
+void httpCacheConditions(Preferences *preferences, const char *url, String *ifNoneMatch, String *ifModifiedSince) {
+  const HttpCacheEntry *entry = httpCacheEntry(preferences, url);
+  *ifNoneMatch = entry != NULL ? entry->etag : "";
+  *ifModifiedSince = entry != NULL ? entry->lastModified : "";
+}
+
+void httpCacheUpdate(Preferences *preferences, const char *url, int status, const String &etag, const String &lastModified,
+                     const String &cacheControl, const String &age, time_t now) {
+  const HttpCacheEntry *previous = httpCacheEntry(preferences, url);
+  HttpCacheEntry entry;
+  memset(&entry, 0, sizeof(entry));
+  entry.magic = HTTP_CACHE_MAGIC;
+  entry.urlHash = fnv1a(url);
+
+  // Not modified: the validators stay unless the server sends new ones
+  if (status == 304 && previous != NULL)
+    entry = *previous;
+  if (status == 200 || status == 304) {
+    if (status == 200 || etag.length() > 0)
+      copyHeader(entry.etag, sizeof(entry.etag), etag);
+    if (status == 200 || lastModified.length() > 0)
+      copyHeader(entry.lastModified, sizeof(entry.lastModified), lastModified);
+    // A shared cache on the way may have held the response for a while already
+    long maxAge = httpCacheMaxAge(cacheControl.c_str());
+    entry.expires = maxAge > 0 ? now + max(maxAge - atol(age.c_str()), 0L) : 0;
+  }
+
+  // Only write to flash when something changed
+  if (memcmp(&entry, &httpCache, sizeof(entry)) == 0)
+    return;
+  httpCache = entry;
+  PROFILE_SCOPE(ProfileStage::NVS_WRITE);
+  preferences->putBytes("http_cache", &httpCache, sizeof(httpCache));
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "os_config.h"
+#include "rtcmagic.h"
+
+#define HTTP_CACHE_MAGIC     RTC_MAGIC('H', 'C', 'T', '1')
+#define HTTP_CACHE_ETAG_SIZE 64
+// An HTTP date is 29 characters
+#define HTTP_CACHE_DATE_SIZE 32
+
+/**
+ * Validators of the last response, for conditional requests
+ *
+ * The result of a request (the weather in the hot state and the forecast) is kept anyway, what the next request
+ * needs is whether that result is still current. The ETag, Last-Modified and the expiry from Cache-Control max-age
+ * of the last response are kept in RTC memory (and in NVS for after a power loss), for one URL. Until the expiry
+ * the request is not made at all, after it the request carries If-None-Match / If-Modified-Since, and a 304 answer
+ * (headers only) means the kept result is still the right one.
+ */
+
+// The headers to collect from the response for httpCacheUpdate()
+extern const char *httpCacheHeaders[4];
+
+// The last response for the URL is still fresh, no need to ask the server
+bool httpCacheFresh(Preferences *preferences, const char *url, time_t now);
+// Validators for a conditional request to the URL, empty when there are none
+void httpCacheConditions(Preferences *preferences, const char *url, String *ifNoneMatch, String *ifModifiedSince);
+// Remember the validators of a 200 or 304 response to the URL, other status codes forget them
+void httpCacheUpdate(Preferences *preferences, const char *url, int status, const String &etag, const String &lastModified,
+                     const String &cacheControl, const String &age, time_t now);
+// Seconds of max-age in a Cache-Control header, 0 for no-cache and -1 without max-age or with no-store
+long httpCacheMaxAge(const char *cacheControl);
@@ -0,0 +1,217 @@
+#include "jsonstream.h"
+
+JsonStream::JsonStream(JsonValueCallback callback, void *context)
+    : _callback(callback), _context(context), _state(State::VALUE), _stringEnd(State::COMMA_OR_END), _depth(0), _skipDepth(0), _length(0),
+      _valueLength(0), _escape(0), _codepoint(0) {
+  _path[0] = '\0';
+}
+
+bool JsonStream::feed(const char *data, size_t length) {
+  for (size_t i = 0; i < length && _state != State::FAILED; i++) {
+    if (!step(data[i]))
+      _state = State::FAILED;
+  }
+  return _state != State::FAILED;
+}
+
+bool JsonStream::append(const char *text, uint8_t length) {
+  if (_length + length >= JSON_STREAM_PATH_SIZE)
+    return false;
+  memcpy(_path + _length, text, length);
+  _length += length;
+  _path[_length] = '\0';
+  return true;
+}
+
+bool JsonStream::push(bool array) {
+  if (_depth == JSON_STREAM_MAX_DEPTH)
+    return false;
+  _array[_depth] = array;
+  // All elements of an array share the path "...[]"
+  if (array && _skipDepth == 0 && !append("[]", 2))
+    _skipDepth = _depth + 1;
+  _pathLength[_depth] = _length;
+  _depth++;
+  _state = array ? State::VALUE : State::KEY_OR_END;
+  return true;
+}
+
+void JsonStream::pop() {
+  _depth--;
+  if (_skipDepth > _depth)
+    _skipDepth = 0;
+  _length = _depth > 0 ? _pathLength[_depth - 1] : 0;
+  _path[_length] = '\0';
+  valueDone();
+}
+
+void JsonStream::valueDone() { _state = _depth == 0 ? State::DONE : State::COMMA_OR_END; }
+
+void JsonStream::emit() {
+  _value[_valueLength] = '\0';
+  if (_skipDepth == 0)
+    _callback(_context, _path, _value);
+}
+
+/**
+ * One character of a string (a key or a value) into the buffer, false when the string is malformed
+ */
+bool JsonStream::stringChar(char c, char *buffer, uint8_t size, uint8_t *length) {
+  char out[3];
+  uint8_t n = 0;
+
+  if (_escape == 1) {
+    static const char escaped[] = "\"\\/bfnrt";
+    static const char replaced[] = "\"\\/\b\f\n\r\t";
+    const char *found = c != '\0' ? strchr(escaped, c) : NULL;
+    if (c == 'u') {
+      _escape = 2;
+      _codepoint = 0;
+      return true;
+    }
+    if (found == NULL)
+      return false;
+    out[n++] = replaced[found - escaped];
+    _escape = 0;
+  } else if (_escape >= 2) {
+    if (!isxdigit((unsigned char)c))
+      return false;
+    _codepoint = _codepoint << 4 | (isdigit((unsigned char)c) ? c - '0' : (tolower((unsigned char)c) - 'a' + 10));
+    if (++_escape < 6)
+      return true;
+    _escape = 0;
+    // Surrogate pairs (emoji) are not worth the state, they become '?'
+    if (_codepoint < 0x80) {
+      out[n++] = _codepoint;
+    } else if (_codepoint < 0x800) {
+      out[n++] = 0xC0 | _codepoint >> 6;
+      out[n++] = 0x80 | (_codepoint & 0x3F);
+    } else if (_codepoint >= 0xD800 && _codepoint < 0xE000) {
+      out[n++] = '?';
+    } else {
+      out[n++] = 0xE0 | _codepoint >> 12;
+      out[n++] = 0x80 | (_codepoint >> 6 & 0x3F);
+      out[n++] = 0x80 | (_codepoint & 0x3F);
+    }
+  } else if (c == '\\') {
+    _escape = 1;
+    return true;
+  } else if ((unsigned char)c < 0x20) {
+    return false;
+  } else {
+    out[n++] = c;
+  }
+
+  // Cut off, never in the middle of a UTF-8 sequence
+  if (*length + n < size) {
+    memcpy(buffer + *length, out, n);
+    *length += n;
+  }
+  return true;
+}
+
+bool JsonStream::step(char c) {
+  bool space = c == ' ' || c == '\t' || c == '\n' || c == '\r';
+
+  switch (_state) {
+  case State::VALUE:
+    if (space)
+      return true;
+    if (c == '{' || c == '[')
+      return push(c == '[');
+    if (c == ']' && _depth > 0 && _array[_depth - 1]) {
+      // Empty array, or a trailing comma which is let through
+      pop();
+      return true;
+    }
+    _valueLength = 0;
+    if (c == '"') {
+      _escape = 0;
+      _stringEnd = State::COMMA_OR_END;
+      _state = State::STRING;
+      return true;
+    }
+    if (c == '-' || isalnum((unsigned char)c)) {
+      _value[_valueLength++] = c;
+      _state = State::LITERAL;
+      return true;
+    }
+    return false;
+
+  case State::LITERAL:
+    if (c == '-' || c == '+' || c == '.' || isalnum((unsigned char)c)) {
+      if (_valueLength < JSON_STREAM_VALUE_SIZE - 1)
+        _value[_valueLength++] = c;
+      return true;
+    }
+    emit();
+    valueDone();
+    // The character after the literal belongs to the structure
+    return step(c);
+
+  case State::STRING:
+    if (c == '"' && _escape == 0) {
+      emit();
+      valueDone();
+      return true;
+    }
+    return stringChar(c, _value, JSON_STREAM_VALUE_SIZE, &_valueLength);
+
+  case State::KEY_OR_END:
+    if (space)
+      return true;
+    if (c == '}') {
+      pop();
+      return true;
+    }
+    if (c != '"')
+      return false;
+    // The key replaces the previous key of this object in the path
+    _length = _pathLength[_depth - 1];
+    _path[_length] = '\0';
+    _valueLength = 0;
+    _escape = 0;
+    _state = State::KEY;
+    return true;
+
+  case State::KEY:
+    if (c == '"' && _escape == 0) {
+      if (_skipDepth == 0 || _skipDepth == _depth) {
+        _skipDepth = 0;
+        if ((_length > 0 && !append(".", 1)) || !append(_value, _valueLength))
+          _skipDepth = _depth;
+      }
+      _state = State::COLON;
+      return true;
+    }
+    // Keys are read into the value buffer, they are appended to the path when complete
+    return stringChar(c, _value, JSON_STREAM_VALUE_SIZE, &_valueLength);
+
+  case State::COLON:
+    if (space)
+      return true;
+    if (c != ':')
+      return false;
+    _state = State::VALUE;
+    return true;
+
+  case State::COMMA_OR_END:
+    if (space)
+      return true;
+    if (c == ',') {
+      _state = _array[_depth - 1] ? State::VALUE : State::KEY_OR_END;
+      return true;
+    }
+    if (c == (_array[_depth - 1] ? ']' : '}')) {
+      pop();
+      return true;
+    }
+    return false;
+
+  case State::DONE:
+    return space;
+
+  default:
+    return false;
+  }
+}
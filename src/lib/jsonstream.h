@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Arduino.h"
+
+// Longest path that is still reported, deeper or longer keys are skipped together with their value
+#define JSON_STREAM_PATH_SIZE  80
+// Longer values are cut off, the callback gets the first JSON_STREAM_VALUE_SIZE - 1 bytes
+#define JSON_STREAM_VALUE_SIZE 64
+// Deeper documents are rejected
+#define JSON_STREAM_MAX_DEPTH  12
+
+// Gets every scalar of the document with its path, e.g. "current.condition.text" or "forecast.forecastday[].date"
+typedef void (*JsonValueCallback)(void *context, const char *path, const char *value);
+
+/**
+ * Incremental JSON parser with a fixed memory footprint
+ *
+ * The document is fed in pieces of any size as they come from the network, nothing of it is kept except the path
+ * to the current value and the value itself, so the memory does not grow with the document. Every string, number,
+ * true, false and null is handed to the callback together with its path: the keys joined by '.', array elements
+ * as "[]". The callback picks what it needs by the path, which makes it the filter. Strings are unescaped (\u to
+ * UTF-8), numbers and the literals are passed as they appear in the document.
+ */
+class JsonStream {
+public:
+  JsonStream(JsonValueCallback callback, void *context);
+
+  // Parse the next piece of the document, false once the document turned out malformed
+  bool feed(const char *data, size_t length);
+  // The top level value is complete
+  bool done() const { return _state == State::DONE; }
+  bool failed() const { return _state == State::FAILED; }
+
+private:
+  enum class State : uint8_t { VALUE, KEY_OR_END, KEY, COLON, COMMA_OR_END, STRING, LITERAL, DONE, FAILED };
+
+  bool push(bool array);
+  void pop();
+  void valueDone();
+  bool append(const char *text, uint8_t length);
+  void emit();
+  bool stringChar(char c, char *buffer, uint8_t size, uint8_t *length);
+  bool step(char c);
+
+  JsonValueCallback _callback;
+  void *_context;
+  State _state;
+  State _stringEnd; // State after the current string, COLON for a key
+  uint8_t _depth;
+  uint8_t _skipDepth; // Depth of the container whose path did not fit, 0 when everything fits
+  bool _array[JSON_STREAM_MAX_DEPTH];
+  uint8_t _pathLength[JSON_STREAM_MAX_DEPTH]; // Length of the path of each open container
+  char _path[JSON_STREAM_PATH_SIZE];
+  uint8_t _length; // Of _path
+  char _value[JSON_STREAM_VALUE_SIZE];
+  uint8_t _valueLength;
+  uint8_t _escape; // 0, 1 after a backslash, 2-5 for the digits of \u
+  uint16_t _codepoint;
+};
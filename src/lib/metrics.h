@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Arduino.h"
+
+// Horizontal metrics of one glyph, generated from the GFXfont by tools/gen_font_metrics.py
+struct GlyphMetrics {
+  uint8_t width;    // Bitmap dimensions in pixels
+  uint8_t xAdvance; // Distance to advance cursor (x axis)
+  int8_t xOffset;   // X dist from cursor pos to UL corner
+};
+
+struct FontMetrics {
+  const GlyphMetrics *glyphs;
+  uint8_t first; // ASCII extents (first char)
+  uint8_t last;  // ASCII extents (last char)
+};
+
+/**
+ * String measurements that can be evaluated by the compiler
+ *
+ * For a literal (or any constexpr) string these are compile time constants, for other strings they are
+ * cheap lookups in the metrics table. The results are the same as the bounds of a TextRun (and of
+ * getTextBounds()): characters that are not in the font are skipped, empty glyphs count. Written as
+ * single (tail recursive) return statements so they are constexpr in C++11 as well.
+ */
+
+constexpr bool inFont(const FontMetrics &font, char c) { return (uint8_t)c >= font.first && (uint8_t)c <= font.last; }
+
+constexpr const GlyphMetrics &glyphMetrics(const FontMetrics &font, char c) { return font.glyphs[(uint8_t)c - font.first]; }
+
+constexpr int16_t glyphAdvance(const FontMetrics &font, char c) { return inFont(font, c) ? glyphMetrics(font, c).xAdvance : 0; }
+
+// Leftmost and rightmost column of the ink of s with the cursor at `cursor`, tail recursive with the result so far in `bound`
+constexpr int16_t textLeft(const FontMetrics &font, const char *s, int16_t cursor = 0, int16_t bound = 0x7FFF) {
+  return !*s ? bound
+             : textLeft(font, s + 1, cursor + glyphAdvance(font, *s),
+                        inFont(font, *s) && cursor + glyphMetrics(font, *s).xOffset < bound ? cursor + glyphMetrics(font, *s).xOffset : bound);
+}
+
+constexpr int16_t textRight(const FontMetrics &font, const char *s, int16_t cursor = 0, int16_t bound = -1) {
+  return !*s ? bound
+             : textRight(font, s + 1, cursor + glyphAdvance(font, *s),
+                         inFont(font, *s) && cursor + glyphMetrics(font, *s).xOffset + glyphMetrics(font, *s).width - 1 > bound
+                             ? cursor + glyphMetrics(font, *s).xOffset + glyphMetrics(font, *s).width - 1
+                             : bound);
+}
+
+// Distance the cursor moves when printing s
+constexpr int16_t textAdvance(const FontMetrics &font, const char *s, int16_t cursor = 0) {
+  return !*s ? cursor : textAdvance(font, s + 1, cursor + glyphAdvance(font, *s));
+}
+
+// Width of the ink of s, the w of getTextBounds()
+constexpr uint16_t textWidth(const FontMetrics &font, const char *s) {
+  return textRight(font, s) >= textLeft(font, s) ? textRight(font, s) - textLeft(font, s) + 1 : 0;
+}
@@ -0,0 +1,83 @@
+#include "netsession.h"
+
+struct NetSessionJob {
+  const char *name;
+  NetJob run;
+};
+
+static NetSessionJob netJobs[NET_SESSION_JOBS];
+static uint8_t netJobCount = 0;
+
+static Preferences *netPreferences = NULL;
+static String netSsid;
+static String netPassword;
+static bool netConnected = false;
+static SemaphoreHandle_t netDone = NULL;
+
+void netSessionAdd(const char *name, NetJob job) {
+  if (netJobCount == NET_SESSION_JOBS) {
+    log(LogLevel::ERROR, (String("Too many network jobs, dropping ") + name).c_str());
+    return;
+  }
+  netJobs[netJobCount++] = {name, job};
+}
+
+static void netSessionTask(void *parameter) {
+  uint32_t start = micros();
+  netConnected = wifiConnect(netPreferences, netSsid, netPassword);
+  if (netConnected) {
+    uint8_t failed = 0;
+    for (uint8_t i = 0; i < netJobCount; i++) {
+      if (!netJobs[i].run(netPreferences)) {
+        log(LogLevel::WARNING, (String("Network job failed: ") + netJobs[i].name).c_str());
+        failed++;
+      }
+    }
+    // Connected to an access point that gets us nowhere, the next session looks for another one
+    if (netJobCount > 0 && failed == netJobCount) {
+      log(LogLevel::WARNING, "All network jobs failed, forgetting the access point");
+      wifiForget(netPreferences);
+    }
+  }
+
+  // Off as soon as the last job is done, saves lots of power
+  WiFi.disconnect(true);
+  WiFi.mode(WIFI_OFF);
+  uint32_t radioUs = micros() - start;
+  profileAdd(ProfileStage::RADIO_ON, radioUs);
+  log(LogLevel::INFO, (String("Radio on for ") + radioUs / 1000 + " ms").c_str());
+
+  xSemaphoreGive(netDone);
+  vTaskDelete(NULL);
+}
+
+bool netSessionBegin(Preferences *preferences) {
+  netSsid = preferences->getString("wifi_ssid", "");
+  netPassword = preferences->getString("wifi_passwd", "");
+  if (netSsid.length() == 0 || netPassword.length() == 0) {
+    log(LogLevel::ERROR, "WiFi not configured, skipping WiFi actions");
+    netJobCount = 0;
+    return false;
+  }
+
+  if (netDone == NULL)
+    netDone = xSemaphoreCreateBinary();
+  netPreferences = preferences;
+  netConnected = false;
+  // Both cores stay at the base frequency until the session is over, the radio needs its 80 MHz anyway
+  governorPin(true);
+  if (xTaskCreatePinnedToCore(netSessionTask, "net", NET_SESSION_STACK, NULL, 1, NULL, NET_SESSION_CORE) != pdPASS) {
+    log(LogLevel::ERROR, "Cannot start the network session");
+    governorPin(false);
+    netJobCount = 0;
+    return false;
+  }
+  return true;
+}
+
+bool netSessionEnd() {
+  xSemaphoreTake(netDone, portMAX_DELAY);
+  governorPin(false);
+  netJobCount = 0;
+  return netConnected;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Arduino.h"
+#include "Preferences.h"
+#include "connection.h"
+#include "governor.h"
+#include "log.h"
+#include "os_config.h"
+#include "profile.h"
+
+// Jobs one session can hold
+#define NET_SESSION_JOBS  4
+// The TLS handshake of the weather request needs most of it
+#define NET_SESSION_STACK 12288
+// The WiFi driver and lwIP run on the protocol core, the jobs join them there and leave the other core to the display
+#define NET_SESSION_CORE  0
+
+// A job of the session, runs while connected, false when it failed (the other jobs still run)
+typedef bool (*NetJob)(Preferences *preferences);
+
+/**
+ * One WiFi session for all the network work of a wake
+ *
+ * The jobs (time sync, weather, ...) are queued and then run one after the other in a task on the protocol core,
+ * within a single connection. The radio is turned off the moment the last job returns, and the time from turning it
+ * on until then is recorded as the "radio on" stage. Meanwhile the calling task keeps the other core and can draw and
+ * refresh the display. The CPU frequency is pinned for the length of the session, as both cores run phases.
+ *
+ * The jobs must not write the state the calling task writes at the same time (the hot state, the canvas).
+ */
+
+// Queue a job for the next session
+void netSessionAdd(const char *name, NetJob job);
+// Start the session with the queued jobs on the protocol core, false (and nothing started) without WiFi credentials
+bool netSessionBegin(Preferences *preferences);
+// Wait until the session is over and the radio is off, true when it connected
+bool netSessionEnd();
@@ -0,0 +1,101 @@
+#include "ntp.h"
+#include "log.h"
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+static int64_t nowUs() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void writeTimestamp(uint8_t *buffer, int64_t us) {
+  uint32_t seconds = (uint32_t)(us / 1000000 + NTP_UNIX_OFFSET); // Wraps into the next era in 2036, as NTP does
+  uint32_t fraction = (uint32_t)(((uint64_t)(us % 1000000) << 32) / 1000000);
+  for (int i = 0; i < 4; i++) {
+    buffer[i] = seconds >> (24 - 8 * i);
+    buffer[4 + i] = fraction >> (24 - 8 * i);
+  }
+}
+
+static int64_t readTimestamp(const uint8_t *buffer) {
+  uint32_t seconds = (uint32_t)buffer[0] << 24 | (uint32_t)buffer[1] << 16 | (uint32_t)buffer[2] << 8 | buffer[3];
+  uint32_t fraction = (uint32_t)buffer[4] << 24 | (uint32_t)buffer[5] << 16 | (uint32_t)buffer[6] << 8 | buffer[7];
+  int64_t unixSeconds = (int64_t)seconds - NTP_UNIX_OFFSET;
+  // Seconds in the lower half are from the era that started in 2036
+  if (seconds < 0x80000000)
+    unixSeconds += 0x100000000LL;
+  return unixSeconds * 1000000 + (int64_t)(((uint64_t)fraction * 1000000) >> 32);
+}
+
+bool ntpQuery(const char *server, uint16_t port, uint32_t timeoutMs, NtpResult *result) {
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_DGRAM;
+  char service[6];
+  snprintf(service, sizeof(service), "%u", port);
+  struct addrinfo *address = NULL;
+  if (getaddrinfo(server, service, &hints, &address) != 0 || address == NULL) {
+    log(LogLevel::WARNING, (String("NTP server not found: ") + server).c_str());
+    return false;
+  }
+
+  int sock = socket(address->ai_family, address->ai_socktype, 0);
+  if (sock < 0) {
+    freeaddrinfo(address);
+    return false;
+  }
+  struct timeval timeout;
+  timeout.tv_sec = timeoutMs / 1000;
+  timeout.tv_usec = timeoutMs % 1000 * 1000;
+  setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  // Version 4, client mode, everything else is zero except our transmit timestamp (T1)
+  uint8_t packet[NTP_PACKET_SIZE];
+  memset(packet, 0, sizeof(packet));
+  packet[0] = 0x23;
+  int64_t t1 = nowUs();
+  writeTimestamp(packet + 40, t1);
+  uint8_t sent[8];
+  memcpy(sent, packet + 40, sizeof(sent));
+
+  bool valid = false;
+  int64_t t4 = 0;
+  uint32_t start = millis();
+  if (sendto(sock, packet, sizeof(packet), 0, address->ai_addr, address->ai_addrlen) == sizeof(packet)) {
+    // Anything that is not the answer to this request (a late answer to an earlier one) is skipped
+    while (!valid && millis() - start < timeoutMs) {
+      ssize_t length = recv(sock, packet, sizeof(packet), 0);
+      t4 = nowUs();
+      if (length < 0)
+        break;
+      valid = length >= NTP_PACKET_SIZE && (packet[0] & 0x07) == 4 && memcmp(packet + 24, sent, sizeof(sent)) == 0;
+    }
+  }
+  close(sock);
+  freeaddrinfo(address);
+
+  if (!valid) {
+    log(LogLevel::WARNING, (String("No answer from NTP server ") + server).c_str());
+    return false;
+  }
+  // Leap indicator 3 is a server without time, stratum 0 a kiss-of-death (go away)
+  if ((packet[0] >> 6) == 3 || packet[1] == 0) {
+    log(LogLevel::WARNING, (String("NTP server ") + server + " is not synchronised").c_str());
+    return false;
+  }
+
+  int64_t t2 = readTimestamp(packet + 32);
+  int64_t t3 = readTimestamp(packet + 40);
+  result->offsetUs = ((t2 - t1) + (t3 - t4)) / 2;
+  result->rttUs = (uint32_t)max((t4 - t1) - (t3 - t2), (int64_t)0);
+  result->stratum = packet[1];
+  return true;
+}
+
+bool ntpQueryServers(NtpResult *result) {
+  return ntpQuery(NTP_SERVER1, NTP_PORT, NTP_TIMEOUT_MS, result) || ntpQuery(NTP_SERVER2, NTP_PORT, NTP_TIMEOUT_MS, result);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Arduino.h"
+#include "os_config.h"
+
+#define NTP_PORT        123
+// An answer later than this is given up on, then the next server is asked
+#define NTP_TIMEOUT_MS  2000
+// Seconds from the NTP epoch (1900) to the Unix epoch (1970)
+#define NTP_UNIX_OFFSET 2208988800LL
+#define NTP_PACKET_SIZE 48
+
+// What one NTP request found out
+struct NtpResult {
+  int64_t offsetUs; // Server time minus system time, corrected for the round trip
+  uint32_t rttUs;   // Round trip minus the time the server held the request
+  uint8_t stratum;
+};
+
+/**
+ * One-shot SNTP client
+ *
+ * A single request per server over a plain UDP socket (lwIP on the watch, the host sockets in the native build), no
+ * background task and no polling. The offset uses the four timestamps of the exchange:
+ * ((T2 - T1) + (T3 - T4)) / 2, which assumes the request and the answer took the same time on the way, so it is off
+ * by at most half the round trip. Answers that do not echo our transmit timestamp, announce an unsynchronised clock
+ * or a kiss-of-death are rejected. The system time is not touched, the caller decides what to do with the offset.
+ */
+
+// Ask one server, false when there is no valid answer within the timeout
+bool ntpQuery(const char *server, uint16_t port, uint32_t timeoutMs, NtpResult *result);
+// Ask NTP_SERVER1, then NTP_SERVER2 when the first one does not answer
+bool ntpQueryServers(NtpResult *result);
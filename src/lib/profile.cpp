@@ -0,0 +1,96 @@
+#include "profile.h"
+
+struct ProfileWake {
+  uint16_t units[(uint8_t)ProfileStage::COUNT]; // In the unit of the stage, 0 when the stage did not run
+};
+
+struct ProfileRing {
+  uint32_t magic;
+  uint8_t head;  // Slot of the current wake
+  uint8_t count; // Number of valid slots
+  ProfileWake wakes[PROFILE_WAKES];
+};
+
+// Stages are timed on both cores, the fast RTC memory can only be reached from the PRO CPU
+RTC_DATA_ATTR ProfileRing profileRing;
+
+static const char *profileStageNames[] = {"boot",          "display init", "draw home", "display update", "display power down", "nvs read",
+                                          "nvs write",     "battery",      "wifi",      "wifi scan",      "wifi connect",       "wifi ip",
+                                          "tls handshake", "radio on",     "loop idle", "awake"};
+
+// The stages that last for seconds (the WiFi session alone may take 15 s) are kept in the long unit
+static const uint16_t profileUnitUs[] = {
+    PROFILE_UNIT_US,      PROFILE_UNIT_US,      PROFILE_UNIT_US,      PROFILE_UNIT_US,      PROFILE_UNIT_US,      PROFILE_UNIT_US,
+    PROFILE_UNIT_US,      PROFILE_UNIT_US,      PROFILE_LONG_UNIT_US, PROFILE_LONG_UNIT_US, PROFILE_LONG_UNIT_US, PROFILE_LONG_UNIT_US,
+    PROFILE_LONG_UNIT_US, PROFILE_LONG_UNIT_US, PROFILE_LONG_UNIT_US, PROFILE_LONG_UNIT_US};
+
+static_assert(sizeof(profileUnitUs) / sizeof(profileUnitUs[0]) == (uint8_t)ProfileStage::COUNT, "Every stage needs a unit");
+
+void profileBeginWake() {
+#if ENABLE_PROFILING
+  if (profileRing.magic != PROFILE_MAGIC || profileRing.head >= PROFILE_WAKES || profileRing.count > PROFILE_WAKES) {
+    memset(&profileRing, 0, sizeof(profileRing));
+    profileRing.magic = PROFILE_MAGIC;
+    profileRing.head = PROFILE_WAKES - 1;
+  }
+
+  profileRing.head = (profileRing.head + 1) % PROFILE_WAKES;
+  if (profileRing.count < PROFILE_WAKES)
+    profileRing.count++;
+  memset(&profileRing.wakes[profileRing.head], 0, sizeof(ProfileWake));
+#endif
+}
+
+void profileEndWake() {
+  // micros() counts from boot
+  profileAdd(ProfileStage::AWAKE, micros());
+}
+
+void profileAdd(ProfileStage stage, uint32_t us) {
+#if ENABLE_PROFILING
+  if (profileRing.magic != PROFILE_MAGIC)
+    return;
+  // Rounded up, a stage that ran is never left at 0 (0 means it did not run)
+  uint16_t *units = &profileRing.wakes[profileRing.head].units[(uint8_t)stage];
+  uint32_t unitUs = profileUnitUs[(uint8_t)stage];
+  uint32_t added = max((us + unitUs - 1) / unitUs, (uint32_t)1);
+  *units = min(*units + added, (uint32_t)UINT16_MAX);
+#endif
+}
+
+void profileDump() {
+  if (profileRing.magic != PROFILE_MAGIC) {
+    Serial.println("No profile recorded");
+    return;
+  }
+
+  Serial.printf("Profile of the last %d wakes (us)\n", profileRing.count);
+  Serial.printf("%-20s %5s %10s %10s %10s\n", "stage", "n", "min", "mean", "p99");
+  for (uint8_t stage = 0; stage < (uint8_t)ProfileStage::COUNT; stage++) {
+    uint32_t samples[PROFILE_WAKES];
+    uint8_t n = 0;
+    uint64_t sum = 0;
+    for (uint8_t i = 0; i < profileRing.count; i++) {
+      uint32_t us = profileRing.wakes[i].units[stage] * profileUnitUs[stage];
+      if (us == 0)
+        continue;
+      // Insertion sort, there are only a few samples
+      uint8_t j = n++;
+      while (j > 0 && samples[j - 1] > us) {
+        samples[j] = samples[j - 1];
+        j--;
+      }
+      samples[j] = us;
+      sum += us;
+    }
+
+    if (n == 0) {
+      Serial.printf("%-20s %5d %10s %10s %10s\n", profileStageNames[stage], 0, "-", "-", "-");
+      continue;
+    }
+    // Nearest rank, with less than 100 wakes this is the slowest one
+    uint8_t p99 = (n * 99 + 99) / 100 - 1;
+    Serial.printf("%-20s %5d %10lu %10lu %10lu\n", profileStageNames[stage], n, (unsigned long)samples[0], (unsigned long)(sum / n),
+                  (unsigned long)samples[p99]);
+  }
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Arduino.h"
+#include "os_config.h"
+#include "rtcmagic.h"
+
+// Number of wakes kept in the ring buffer, the statistics are over these
+#define PROFILE_WAKES        16
+// Resolution of the recorded durations, they are kept in 16 bits: the short stages in steps of 0.1 ms up to 6.5 s,
+// the network and whole wake stages in steps of 1 ms up to 65 s (the unit of each stage is in profile.cpp)
+#define PROFILE_UNIT_US      100
+#define PROFILE_LONG_UNIT_US 1000
+
+// The parts of a wake that are timed, a stage can be timed several times per wake, the durations add up
+enum class ProfileStage : uint8_t {
+  BOOT,               // Setting up the peripherals before the wake is handled
+  DISPLAY_INIT,       // display.init()
+  DRAW_HOME,          // Drawing the home screen into the canvas
+  DISPLAY_UPDATE,     // Pushing the frame to the panel (updateWindow() / update())
+  DISPLAY_POWER_DOWN, // display.powerDown()
+  NVS_READ,           // Preferences reads
+  NVS_WRITE,          // Preferences writes
+  BATTERY,            // calculateBatteryStatus()
+  WIFI,               // Waiting for the network session and drawing what it brought
+  WIFI_SCAN,          // Scanning for the access point (only when the cached one failed)
+  WIFI_CONNECT,       // WiFi.begin() until associated with the access point
+  WIFI_IP,            // Associated until DHCP gave us an IP
+  TLS_HANDSHAKE,      // TLS handshake of an HTTPS request (short when the session is resumed)
+  RADIO_ON,           // WiFi turned on until turned off again by the network session
+  LOOP_IDLE,          // The main loop blocked waiting for events
+  AWAKE,              // Boot until going back to sleep
+  COUNT
+};
+
+#define PROFILE_MAGIC RTC_MAGIC('P', 'R', 'O', ProfileStage::COUNT)
+
+// Start a new wake in the ring buffer, call it first thing after booting
+void profileBeginWake();
+// Record the total awake time of this wake, call it right before going to sleep
+void profileEndWake();
+// Add a duration to a stage of the current wake
+void profileAdd(ProfileStage stage, uint32_t us);
+// Print min, mean and p99 of every stage over the wakes in the ring buffer to the serial port
+void profileDump();
+
+/**
+ * Times the scope it lives in and adds the duration to a stage of the current wake
+ */
+class ProfileTimer {
+public:
+  ProfileTimer(ProfileStage stage) : _stage(stage), _start(micros()) {}
+  ~ProfileTimer() { profileAdd(_stage, micros() - _start); }
+
+private:
+  ProfileStage _stage;
+  uint32_t _start;
+};
+
+#if ENABLE_PROFILING
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b)  PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(stage)  ProfileTimer PROFILE_CONCAT(profileTimer, __LINE__)(stage)
+#else
+#define PROFILE_SCOPE(stage)
+#endif
@@ -0,0 +1,184 @@
+#include "renderer.h"
+#include "log.h"
+#include "profile.h"
+#include "rom/crc.h"
+
+// Snapshot of the frame on the panel, the e-paper keeps showing it during deep sleep and so do we
+RTC_DATA_ATTR uint8_t shownFrame[FRAME_BUFFER_SIZE];
+RTC_DATA_ATTR uint32_t shownFrameMagic = 0;
+RTC_DATA_ATTR uint32_t shownFrameChecksum = 0;
+
+FrameRenderer::FrameRenderer(GxEPD_Class *display) : _display(display), _canvas(GxEPD_WIDTH, GxEPD_HEIGHT), _shown(shownFrame), _valid(false) {}
+
+bool FrameRenderer::restore() {
+  if (shownFrameMagic != FRAME_MAGIC || shownFrameChecksum != crc32_le(0, _shown, FRAME_BUFFER_SIZE)) {
+    log(LogLevel::WARNING, "No valid frame in RTC memory, redrawing the complete screen");
+    invalidate();
+    return false;
+  }
+
+  memcpy(_canvas.getBuffer(), _shown, FRAME_BUFFER_SIZE);
+  _valid = true;
+  return true;
+}
+
+void FrameRenderer::invalidate() {
+  _valid = false;
+  shownFrameMagic = 0;
+}
+
+/**
+ * Push the changed parts of the canvas to the display
+ *
+ * The frames are compared row by row in the native layout of the panel. Rows that changed and are close
+ * to each other are grouped into one byte aligned window, so updating the minutes only refreshes the
+ * area of the minute digits instead of the full screen.
+ */
+void FrameRenderer::flush() {
+  PROFILE_SCOPE(ProfileStage::DISPLAY_UPDATE);
+  RenderRegion regions[RENDER_MAX_REGIONS];
+  uint8_t count = 0;
+
+  if (_valid) {
+    count = findRegions(regions);
+  } else {
+    // We do not know what is on the panel, refresh all of it
+    regions[0] = {0, 0, GxEPD_WIDTH, GxEPD_HEIGHT};
+    count = 1;
+  }
+
+  if (count == 0) {
+    log(LogLevel::INFO, "Frame unchanged, skipping display refresh");
+    return;
+  }
+
+  for (uint8_t i = 0; i < count; i++) {
+    pushRegion(regions[i]);
+  }
+
+  saveShown();
+}
+
+/**
+ * Push the complete canvas to the display with a full (flashing) update
+ */
+void FrameRenderer::flushFull() {
+  PROFILE_SCOPE(ProfileStage::DISPLAY_UPDATE);
+  copyToDisplay(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT);
+  _display->update();
+
+  saveShown();
+}
+
+/**
+ * Find the byte aligned rectangles that differ between the canvas and the frame on the panel
+ * Returns the number of regions found, 0 when nothing changed
+ */
+uint8_t FrameRenderer::findRegions(RenderRegion *regions) {
+  const uint8_t *frame = _canvas.getBuffer();
+  uint8_t count = 0;
+  uint32_t area = 0;
+
+  int16_t top = -1;
+  int16_t bottom = 0;
+  uint8_t left = 0;
+  uint8_t right = 0;
+
+  for (uint16_t y = 0; y <= GxEPD_HEIGHT; y++) {
+    int16_t first = -1;
+    int16_t last = -1;
+
+    if (y < GxEPD_HEIGHT) {
+      const uint8_t *next = frame + y * FRAME_ROW_BYTES;
+      const uint8_t *shown = _shown + y * FRAME_ROW_BYTES;
+      for (uint8_t i = 0; i < FRAME_ROW_BYTES; i++) {
+        if (next[i] != shown[i]) {
+          if (first < 0)
+            first = i;
+          last = i;
+        }
+      }
+      if (first < 0 || (top >= 0 && y - bottom <= RENDER_MERGE_GAP)) {
+        // Row unchanged, or close enough to the current band to be merged with it
+        if (first >= 0) {
+          left = min(left, (uint8_t)first);
+          right = max(right, (uint8_t)last);
+          bottom = y;
+        }
+        continue;
+      }
+    }
+
+    // Close the current band (if any)
+    if (top >= 0) {
+      RenderRegion region = {(uint16_t)(left * 8), (uint16_t)top, (uint16_t)((right - left + 1) * 8), (uint16_t)(bottom - top + 1)};
+      if (count < RENDER_MAX_REGIONS) {
+        regions[count++] = region;
+      } else {
+        // Too many windows, grow the last one so it covers this band as well
+        RenderRegion *last = &regions[count - 1];
+        area -= last->w * last->h;
+        uint16_t x0 = min(last->x, region.x);
+        uint16_t x1 = max(last->x + last->w, region.x + region.w);
+        last->x = x0;
+        last->w = x1 - x0;
+        last->h = region.y + region.h - last->y;
+        region = *last;
+      }
+      area += region.w * region.h;
+    }
+
+    // Start a new band
+    top = first >= 0 ? y : -1;
+    bottom = y;
+    left = first;
+    right = last;
+  }
+
+  // Most of the screen changed, a single window is cheaper than several
+  if (count > 1 && area > (uint32_t)GxEPD_WIDTH * GxEPD_HEIGHT / 2) {
+    regions[0] = {0, 0, GxEPD_WIDTH, GxEPD_HEIGHT};
+    count = 1;
+  }
+
+  return count;
+}
+
+/**
+ * Refresh one region of the panel
+ * The area is first set black and then white before the new content is drawn, without this the
+ * partial update leaves ghost pixels behind (especially when running on battery)
+ */
+void FrameRenderer::pushRegion(const RenderRegion &region) {
+  _display->fillRect(region.x, region.y, region.w, region.h, GxEPD_BLACK);
+  _display->updateWindow(region.x, region.y, region.w, region.h, false);
+  _display->fillRect(region.x, region.y, region.w, region.h, GxEPD_WHITE);
+  _display->updateWindow(region.x, region.y, region.w, region.h, false);
+
+  copyToDisplay(region.x, region.y, region.w, region.h);
+  _display->updateWindow(region.x, region.y, region.w, region.h, false);
+}
+
+/**
+ * Copy a rectangle of the canvas into the display buffer, the display is never rotated
+ */
+void FrameRenderer::copyToDisplay(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  const uint8_t *frame = _canvas.getBuffer();
+  for (uint16_t row = y; row < y + h; row++) {
+    const uint8_t *line = frame + row * FRAME_ROW_BYTES;
+    for (uint16_t col = x; col < x + w; col++) {
+      bool white = line[col / 8] & (0x80 >> (col & 7));
+      _display->drawPixel(col, row, white ? GxEPD_WHITE : GxEPD_BLACK);
+    }
+  }
+}
+
+/**
+ * Remember the canvas as the frame shown on the panel
+ */
+void FrameRenderer::saveShown() {
+  memcpy(_shown, _canvas.getBuffer(), FRAME_BUFFER_SIZE);
+  shownFrameChecksum = crc32_le(0, _shown, FRAME_BUFFER_SIZE);
+  shownFrameMagic = FRAME_MAGIC;
+  _valid = true;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Adafruit_GFX.h"
+#include "Arduino.h"
+#include "GxEPD.h"
+#include "canvas.h"
+#include "rtcmagic.h"
+#include <GxDEPG0150BN/GxDEPG0150BN.h> // 1.54" b/w 200x200
+
+// Size of one 1bpp frame in the panel's native (unrotated) layout, this is the same layout as the GxEPD buffer
+#define FRAME_ROW_BYTES    ((GxEPD_WIDTH + 7) / 8)
+#define FRAME_BUFFER_SIZE  (FRAME_ROW_BYTES * GxEPD_HEIGHT)
+
+// At most this many windows are refreshed per flush, anything more is merged together
+#define RENDER_MAX_REGIONS 4
+// Changed rows closer than this are refreshed as one window, every window costs 3 panel refreshes
+#define RENDER_MERGE_GAP   16
+#define FRAME_MAGIC        RTC_MAGIC('F', 'R', 'M', '1')
+
+struct RenderRegion {
+  uint16_t x; // Always a multiple of 8 (byte aligned)
+  uint16_t y;
+  uint16_t w; // Always a multiple of 8 (byte aligned)
+  uint16_t h;
+};
+
+/**
+ * Differential renderer for the e-paper display
+ *
+ * The UI is drawn into an off-screen canvas instead of the display. The canvas has the rotation of the UI
+ * built in, the display itself always stays at rotation 0 and only receives the panel layout. On flush() the canvas is compared
+ * with the frame that is currently shown on the panel and only the changed (byte aligned) rectangles
+ * are pushed to the display, each with its own black/white ghost-clearing pass.
+ *
+ * The shown frame is kept in RTC slow memory (5000 bytes of the 8KB) together with a checksum, so it
+ * survives deep sleep. After a timer wake restore() puts it back into the canvas and only the elements
+ * which changed have to be drawn again.
+ */
+class FrameRenderer {
+public:
+  FrameRenderer(GxEPD_Class *display);
+
+  // The canvas to draw the next frame into, it keeps the content of the last frame
+  WatchCanvas *canvas() { return &_canvas; }
+
+  // Push the changed parts of the canvas to the display using partial updates
+  void flush();
+  // Push the complete canvas to the display with a full (flashing) update
+  void flushFull();
+  // Load the frame shown on the panel from RTC memory into the canvas
+  // Returns false (and the next flush() refreshes the complete screen) when the snapshot is missing or corrupted
+  bool restore();
+  // Forget what is shown on the panel, the next flush() refreshes the complete screen
+  void invalidate();
+
+private:
+  uint8_t findRegions(RenderRegion *regions);
+  void pushRegion(const RenderRegion &region);
+  void copyToDisplay(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void saveShown();
+
+  GxEPD_Class *_display;
+  WatchCanvas _canvas;
+  // The frame that is currently shown on the panel (lives in RTC memory)
+  uint8_t *_shown;
+  bool _valid;
+};
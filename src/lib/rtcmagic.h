@@ -0,0 +1,13 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * Magic that starts every struct kept in RTC memory across deep sleep
+ *
+ * RTC memory is random after a power loss, a struct is only used when its magic says we wrote it, otherwise it is
+ * reset (or reloaded from NVS). The magic is three letters naming the struct and a layout byte: a version, or the
+ * number of entries of the enum that sizes the struct, so that a struct with another layout is not picked up after
+ * a firmware update.
+ */
+#define RTC_MAGIC(a, b, c, layout) (((uint32_t)(a) << 24) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 8) | (uint8_t)(layout))
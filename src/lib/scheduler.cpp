@@ -0,0 +1,84 @@
+#include "scheduler.h"
+#include "log.h"
+#include <time.h>
+
+struct JobConfig {
+  const char *name;
+  uint32_t periodS;
+  uint32_t costUAh; // Estimated charge of one run
+};
+
+// Rough costs from the awake times: the ADC is read for a few ms, the WiFi is on for 10-30 s at ~120 mA, a checkpoint
+// writes a few NVS entries
+static const JobConfig jobConfigs[] = {
+    {"battery", 10 * 60, 1},
+    {"wifi", 12 * 3600, 1000}, // The weather comes with a forecast of 24 hours
+    {"checkpoint", 3600, 1},
+};
+
+static_assert(sizeof(jobConfigs) / sizeof(jobConfigs[0]) == (uint8_t)ScheduledJob::COUNT, "Every job needs a config");
+
+struct SchedulerState {
+  uint32_t magic;
+  int64_t deadlines[(uint8_t)ScheduledJob::COUNT]; // System time (s since the epoch) the job is due
+};
+
+RTC_DATA_ATTR SchedulerState scheduler;
+
+// The next point on the grid of the period after now
+static int64_t nextDeadline(const JobConfig &config, int64_t now) { return (now / config.periodS + 1) * config.periodS; }
+
+/**
+ * The deadline of a job, the deadlines start over when the RTC memory was lost or the time jumped back far
+ */
+static int64_t &deadline(ScheduledJob job, int64_t now) {
+  if (scheduler.magic != SCHEDULER_MAGIC) {
+    for (uint8_t i = 0; i < (uint8_t)ScheduledJob::COUNT; i++) {
+      scheduler.deadlines[i] = nextDeadline(jobConfigs[i], now);
+    }
+    scheduler.magic = SCHEDULER_MAGIC;
+  }
+
+  const JobConfig &config = jobConfigs[(uint8_t)job];
+  int64_t &due = scheduler.deadlines[(uint8_t)job];
+  if (due > now + max((int64_t)config.periodS, (int64_t)SCHEDULER_MAX_DEFER_S)) {
+    due = nextDeadline(config, now);
+  }
+  return due;
+}
+
+bool schedulerTake(ScheduledJob job, int batteryLevel) {
+  int64_t now = time(NULL);
+  // Anything due before the next minute wake is done in this one
+  int64_t nextWake = now + timekeeperSleepUs() / 1000000;
+  int64_t &due = deadline(job, now);
+  if (due > nextWake)
+    return false;
+
+  const JobConfig &config = jobConfigs[(uint8_t)job];
+  due = nextDeadline(config, now);
+  if (batteryLevel < SCHEDULER_LOW_BATTERY && config.costUAh > SCHEDULER_EXPENSIVE_UAH) {
+    log(LogLevel::WARNING, (String("Battery low, skipping ") + config.name).c_str());
+    return false;
+  }
+  return true;
+}
+
+void schedulerRan(ScheduledJob job) {
+  int64_t now = time(NULL);
+  deadline(job, now) = nextDeadline(jobConfigs[(uint8_t)job], now);
+}
+
+void schedulerDefer(ScheduledJob job, uint32_t seconds) {
+  int64_t now = time(NULL);
+  deadline(job, now) = now + min(seconds, (uint32_t)SCHEDULER_MAX_DEFER_S);
+}
+
+uint64_t schedulerSleepUs() {
+  int64_t now = time(NULL);
+  uint64_t sleepUs = timekeeperSleepUs();
+  for (uint8_t i = 0; i < (uint8_t)ScheduledJob::COUNT; i++) {
+    sleepUs = min(sleepUs, timekeeperSleepUntilUs(deadline((ScheduledJob)i, now) * 1000000));
+  }
+  return sleepUs;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Arduino.h"
+#include "os_config.h"
+#include "rtcmagic.h"
+#include "timekeeper.h"
+
+// Below this battery level (%) the expensive jobs are skipped until the battery is charged again
+#define SCHEDULER_LOW_BATTERY   20
+// Jobs that cost more than this (uAh per run) are expensive
+#define SCHEDULER_EXPENSIVE_UAH 100
+// Longest a job can be put off with schedulerDefer()
+#define SCHEDULER_MAX_DEFER_S   (24 * 3600)
+
+/**
+ * The periodic jobs of the timer wakes
+ *
+ * Drawing the minute is the base job, every timer wake does it and the timekeeper decides when that is. The jobs
+ * here run on top of it: each has a deadline in RTC memory on a grid of its period (the battery at every full
+ * 10 minutes, ...). A wake runs every job that is due before the next minute wake, so jobs share wakes instead of
+ * adding their own, and the deep sleep lasts until the earliest deadline.
+ */
+enum class ScheduledJob : uint8_t {
+  BATTERY,    // Measure the battery level
+  WIFI,       // Sync the time and fetch the weather
+  CHECKPOINT, // Write the hot state to NVS
+  COUNT
+};
+
+#define SCHEDULER_MAGIC RTC_MAGIC('S', 'J', 'B', ScheduledJob::COUNT)
+
+// Whether the job should run in this wake, this moves its deadline to the next period
+// An expensive job that is due on a low battery is skipped (and deferred to its next period)
+bool schedulerTake(ScheduledJob job, int batteryLevel);
+// The job was run outside of the schedule (at power on, on a button press), its next run is a period later
+void schedulerRan(ScheduledJob job);
+// Run the job again in this many seconds instead of at its next period (retries, backoff)
+void schedulerDefer(ScheduledJob job, uint32_t seconds);
+// Microseconds of deep sleep until the next minute or the next job, whichever comes first
+uint64_t schedulerSleepUs();
@@ -0,0 +1,99 @@
+#include "timekeeper.h"
+#include "log.h"
+#include <sys/time.h>
+
+struct TimekeeperState {
+  uint32_t magic;
+  int32_t driftPpm;         // Real time minus RTC time, per second of RTC time
+  int64_t lastCorrectedUs;  // System time (us since the epoch) of the last drift correction
+  int64_t lastSyncUs;       // System time of the last NTP sync, 0 when the time did not come from NTP
+  uint32_t renderLatencyUs; // Average time from waking up until the time is drawn
+};
+
+RTC_DATA_ATTR TimekeeperState timekeeper;
+
+static int64_t nowUs() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void setNowUs(int64_t us) {
+  struct timeval tv;
+  tv.tv_sec = us / 1000000;
+  tv.tv_usec = us % 1000000;
+  settimeofday(&tv, NULL);
+}
+
+// The sleep timer counts RTC time, which passes slower or faster than the real time by the drift
+static uint64_t toRtcUs(int64_t us) { return us - us * timekeeper.driftPpm / 1000000; }
+
+static void timekeeperReset() {
+  memset(&timekeeper, 0, sizeof(timekeeper));
+  timekeeper.magic = TIMEKEEPER_MAGIC;
+  timekeeper.lastCorrectedUs = nowUs();
+  timekeeper.renderLatencyUs = TIMEKEEPER_DEFAULT_LATENCY_US;
+}
+
+void timekeeperBegin() {
+  if (timekeeper.magic != TIMEKEEPER_MAGIC) {
+    timekeeperReset();
+    return;
+  }
+
+  int64_t now = nowUs();
+  int64_t elapsed = now - timekeeper.lastCorrectedUs;
+  if (elapsed <= 0 || elapsed > TIMEKEEPER_MAX_CORRECT_GAP) {
+    timekeeper.lastCorrectedUs = now;
+    return;
+  }
+
+  now += elapsed * timekeeper.driftPpm / 1000000;
+  setNowUs(now);
+  timekeeper.lastCorrectedUs = now;
+}
+
+void timekeeperTimeSet() {
+  if (timekeeper.magic != TIMEKEEPER_MAGIC)
+    timekeeperReset();
+  timekeeper.lastCorrectedUs = nowUs();
+  timekeeper.lastSyncUs = 0;
+}
+
+void timekeeperSynced(int64_t offsetUs) {
+  if (timekeeper.magic != TIMEKEEPER_MAGIC)
+    timekeeperReset();
+
+  // While awake the time runs from the crystal, the drift is all in the RTC time before the sync
+  int64_t predicted = nowUs();
+  int64_t ntp = predicted + offsetUs;
+  setNowUs(ntp);
+  int64_t interval = predicted - timekeeper.lastSyncUs;
+
+  if (timekeeper.lastSyncUs != 0 && interval >= TIMEKEEPER_MIN_SYNC_INTERVAL) {
+    // The corrections since the last sync used the old drift, the offset is what it got wrong
+    int64_t drift = timekeeper.driftPpm + offsetUs * 1000000 / interval;
+    timekeeper.driftPpm = constrain(drift, -TIMEKEEPER_MAX_DRIFT_PPM, TIMEKEEPER_MAX_DRIFT_PPM);
+  }
+
+  timekeeper.lastSyncUs = ntp;
+  timekeeper.lastCorrectedUs = ntp;
+  log(LogLevel::INFO, (String("Time synced, offset ") + (long)offsetUs + " us, drift " + timekeeper.driftPpm + " ppm").c_str());
+}
+
+void timekeeperMarkRender() {
+  // micros() counts from boot, the ROM and the bootloader come on top, so the estimate errs on the late side
+  timekeeper.renderLatencyUs = (timekeeper.renderLatencyUs * 3 + micros()) / 4;
+}
+
+uint64_t timekeeperSleepUs() {
+  int64_t untilMinute = 60000000 - nowUs() % 60000000;
+  int64_t sleepUs = untilMinute - timekeeper.renderLatencyUs + TIMEKEEPER_WAKE_MARGIN_US;
+  // Too close to the minute to wake up early for it, wake up a little late instead of skipping it
+  if (sleepUs < TIMEKEEPER_MIN_SLEEP_US)
+    sleepUs = max(untilMinute + TIMEKEEPER_WAKE_MARGIN_US, (int64_t)TIMEKEEPER_MIN_SLEEP_US);
+
+  return toRtcUs(sleepUs);
+}
+
+uint64_t timekeeperSleepUntilUs(int64_t wakeUs) { return toRtcUs(max(wakeUs - nowUs(), (int64_t)TIMEKEEPER_MIN_SLEEP_US)); }
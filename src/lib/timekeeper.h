@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Arduino.h"
+#include "os_config.h"
+#include "rtcmagic.h"
+
+#define TIMEKEEPER_MAGIC              RTC_MAGIC('T', 'K', 'P', '1')
+// Drift estimates beyond this are treated as measurement errors, the RTC slow clock is off by a few % at worst
+#define TIMEKEEPER_MAX_DRIFT_PPM      50000
+// Syncs closer together than this say more about the NTP jitter than about the drift, they do not update it
+#define TIMEKEEPER_MIN_SYNC_INTERVAL  (3600LL * 1000000)
+// Longer gaps (or a clock that went backwards) mean the time was set by someone else, they are not corrected
+#define TIMEKEEPER_MAX_CORRECT_GAP    (24LL * 3600 * 1000000)
+// Wake up this much after the computed moment, rather show the new minute a little late than the old one
+#define TIMEKEEPER_WAKE_MARGIN_US     50000
+// Guess for the time from waking up to drawing the time until the first wake has measured it
+#define TIMEKEEPER_DEFAULT_LATENCY_US 300000
+// Shortest sleep to plan, there has to be time to go to sleep at all
+#define TIMEKEEPER_MIN_SLEEP_US       100000
+
+/**
+ * Keeps the displayed minute in step with the real one
+ *
+ * During deep sleep the system time is kept by the RTC slow clock, which runs a bit too fast or too slow. The drift
+ * is learned from NTP syncs: the offset found at a sync divided by the time since the previous sync. Every wake
+ * corrects the time for the drift since the last correction, and the deep sleep is planned to end right before the
+ * next minute boundary, early by the measured time from waking up until the time is drawn.
+ */
+
+// Correct the system time for the drift since the last wake, call it first thing after booting
+void timekeeperBegin();
+// The time was set by hand (not by NTP), start over from there
+void timekeeperTimeSet();
+// Move the system time by the offset an NTP request found, the offset updates the drift
+void timekeeperSynced(int64_t offsetUs);
+// Call right before the time is read for drawing, measures how long a wake takes to get there
+void timekeeperMarkRender();
+// Microseconds of deep sleep until the display has to show the next minute
+uint64_t timekeeperSleepUs();
+// Microseconds of deep sleep until the given system time (us since the epoch)
+uint64_t timekeeperSleepUntilUs(int64_t wakeUs);
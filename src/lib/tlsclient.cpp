@@ -0,0 +1,255 @@
+#include "tlsclient.h"
+#include "hash.h"
+#include "log.h"
+#include "lwip/sockets.h"
+#include "mbedtls/net_sockets.h"
+#include "mbedtls/platform.h"
+
+struct TlsCache {
+  uint32_t magic;
+  uint32_t hostHash; // The host the address and the session belong to
+  uint32_t ip;       // IPv4 address as IPAddress stores it, 0 when there is none
+  uint16_t sessionLength;
+  uint8_t session[TLS_SESSION_SIZE]; // mbedtls_ssl_session_save()
+};
+
+RTC_DATA_ATTR TlsCache tlsCache;
+
+// The TLS records go over the socket of the WiFiClient
+static int tlsSend(void *context, const unsigned char *buf, size_t len) {
+  int sent = send(*(int *)context, buf, len, 0);
+  if (sent < 0)
+    return errno == EAGAIN || errno == EWOULDBLOCK ? MBEDTLS_ERR_SSL_TIMEOUT : MBEDTLS_ERR_NET_SEND_FAILED;
+  return sent;
+}
+
+static int tlsRecv(void *context, unsigned char *buf, size_t len) {
+  int received = recv(*(int *)context, buf, len, 0);
+  if (received < 0)
+    return errno == EAGAIN || errno == EWOULDBLOCK ? MBEDTLS_ERR_SSL_TIMEOUT : MBEDTLS_ERR_NET_RECV_FAILED;
+  if (received == 0)
+    return MBEDTLS_ERR_NET_CONN_RESET;
+  return received;
+}
+
+ResumableTlsClient::ResumableTlsClient() : _tls(false), _peeked(-1), _socket(-1) {}
+
+ResumableTlsClient::~ResumableTlsClient() { stop(); }
+
+int ResumableTlsClient::connect(IPAddress ip, uint16_t port) { return connect(ip, port, TLS_TIMEOUT_MS); }
+
+int ResumableTlsClient::connect(IPAddress ip, uint16_t port, int32_t timeout) {
+  // Without a host name there is no SNI and no session to match
+  if (!WiFiClient::connect(ip, port, timeout))
+    return 0;
+  return handshake(NULL);
+}
+
+int ResumableTlsClient::connect(const char *host, uint16_t port) { return connect(host, port, TLS_TIMEOUT_MS); }
+
+int ResumableTlsClient::connect(const char *host, uint16_t port, int32_t timeout) {
+  uint32_t hash = fnv1a(host);
+  if (tlsCache.magic != TLS_CACHE_MAGIC || tlsCache.hostHash != hash) {
+    memset(&tlsCache, 0, sizeof(tlsCache));
+    tlsCache.magic = TLS_CACHE_MAGIC;
+    tlsCache.hostHash = hash;
+  }
+
+  // The address of the last time saves the DNS lookup
+  if (tlsCache.ip != 0 && WiFiClient::connect(IPAddress(tlsCache.ip), port, timeout)) {
+    if (handshake(host))
+      return 1;
+    // It still answers but may not serve the host any more, the name is looked up again
+    log(LogLevel::WARNING, "TLS on the cached address failed, resolving the host again");
+  }
+
+  // Only an address that made it through a handshake is kept
+  tlsCache.ip = 0;
+  IPAddress ip;
+  if (!WiFi.hostByName(host, ip)) {
+    log(LogLevel::ERROR, (String("Cannot resolve ") + host).c_str());
+    return 0;
+  }
+  if (!WiFiClient::connect(ip, port, timeout) || !handshake(host))
+    return 0;
+  tlsCache.ip = ip;
+  return 1;
+}
+
+bool ResumableTlsClient::handshake(const char *host) {
+  PROFILE_SCOPE(ProfileStage::TLS_HANDSHAKE);
+  freeTls();
+  _tls = true;
+  mbedtls_ssl_init(&_ssl);
+  mbedtls_ssl_config_init(&_config);
+  mbedtls_entropy_init(&_entropy);
+  mbedtls_ctr_drbg_init(&_drbg);
+
+  // The handshake blocks on the socket, a server that does not answer must not keep the radio on forever
+  _socket = fd();
+  struct timeval timeout;
+  timeout.tv_sec = TLS_TIMEOUT_MS / 1000;
+  timeout.tv_usec = TLS_TIMEOUT_MS % 1000 * 1000;
+  setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  setsockopt(_socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+  int error = mbedtls_ctr_drbg_seed(&_drbg, mbedtls_entropy_func, &_entropy, NULL, 0);
+  if (error == 0)
+    error = mbedtls_ssl_config_defaults(&_config, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+  if (error == 0) {
+    mbedtls_ssl_conf_authmode(&_config, MBEDTLS_SSL_VERIFY_NONE);
+    mbedtls_ssl_conf_rng(&_config, mbedtls_ctr_drbg_random, &_drbg);
+    mbedtls_ssl_conf_session_tickets(&_config, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+    error = mbedtls_ssl_setup(&_ssl, &_config);
+  }
+  if (error == 0 && host != NULL)
+    error = mbedtls_ssl_set_hostname(&_ssl, host);
+  if (error != 0) {
+    log(LogLevel::ERROR, (String("TLS setup failed: -0x") + String(-error, HEX)).c_str());
+    stop();
+    return false;
+  }
+  mbedtls_ssl_set_bio(&_ssl, &_socket, tlsSend, tlsRecv, NULL);
+
+  // Offer the session of the last time, the server decides whether it still knows it
+  bool offered = false;
+  if (host != NULL && tlsCache.sessionLength > 0) {
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+    offered = mbedtls_ssl_session_load(&session, tlsCache.session, tlsCache.sessionLength) == 0 &&
+              mbedtls_ssl_set_session(&_ssl, &session) == 0;
+    mbedtls_ssl_session_free(&session);
+  }
+
+  uint32_t start = micros();
+  while ((error = mbedtls_ssl_handshake(&_ssl)) != 0) {
+    if (error != MBEDTLS_ERR_SSL_WANT_READ && error != MBEDTLS_ERR_SSL_WANT_WRITE) {
+      log(LogLevel::ERROR, (String("TLS handshake failed: -0x") + String(-error, HEX)).c_str());
+      // The session may be what the server choked on, the next connection starts over
+      tlsCache.sessionLength = 0;
+      stop();
+      return false;
+    }
+  }
+  log(LogLevel::INFO, (String("TLS handshake ") + (micros() - start) / 1000 + " ms" + (offered ? ", session offered" : "")).c_str());
+
+  // Keep the session (the server may have sent a new ticket) for the next wake
+  if (host != NULL) {
+    mbedtls_ssl_session session;
+    mbedtls_ssl_session_init(&session);
+    size_t length = 0;
+    bool got = mbedtls_ssl_get_session(&_ssl, &session) == 0;
+#if defined(MBEDTLS_SSL_KEEP_PEER_CERTIFICATE)
+    // The ESP-IDF default keeps the certificate of the server in the session, more than 1 KB of DER. It is never
+    // verified and a resumed handshake does not send it again, only the session ID or ticket is worth keeping
+    if (got && session.peer_cert != NULL) {
+      mbedtls_x509_crt_free(session.peer_cert);
+      mbedtls_free(session.peer_cert);
+      session.peer_cert = NULL;
+    }
+#endif
+    if (got && mbedtls_ssl_session_save(&session, tlsCache.session, sizeof(tlsCache.session), &length) == 0) {
+      tlsCache.sessionLength = length;
+    } else {
+      tlsCache.sessionLength = 0;
+      log(LogLevel::WARNING, "TLS session not kept, there is none or it does not fit");
+    }
+    mbedtls_ssl_session_free(&session);
+  }
+  return true;
+}
+
+size_t ResumableTlsClient::write(uint8_t data) { return write(&data, 1); }
+
+size_t ResumableTlsClient::write(const uint8_t *buf, size_t size) {
+  if (!_tls)
+    return 0;
+  size_t written = 0;
+  while (written < size) {
+    int n = mbedtls_ssl_write(&_ssl, buf + written, size - written);
+    if (n == MBEDTLS_ERR_SSL_WANT_READ || n == MBEDTLS_ERR_SSL_WANT_WRITE)
+      continue;
+    if (n < 0) {
+      stop();
+      break;
+    }
+    written += n;
+  }
+  return written;
+}
+
+int ResumableTlsClient::available() {
+  if (!_tls)
+    return 0;
+  int peeked = _peeked >= 0 ? 1 : 0;
+  // Decrypt the next record only when there is data on the socket, otherwise the read would block
+  if (mbedtls_ssl_get_bytes_avail(&_ssl) == 0) {
+    int pending = 0;
+    if (ioctl(_socket, FIONREAD, &pending) < 0 || pending == 0)
+      return peeked;
+    int error = mbedtls_ssl_read(&_ssl, NULL, 0);
+    if (error < 0 && error != MBEDTLS_ERR_SSL_WANT_READ && error != MBEDTLS_ERR_SSL_WANT_WRITE) {
+      // The server closed the connection (close notify) or it broke, what was decrypted is all there is
+      stop();
+      return peeked;
+    }
+  }
+  return mbedtls_ssl_get_bytes_avail(&_ssl) + peeked;
+}
+
+int ResumableTlsClient::read() {
+  uint8_t data;
+  return read(&data, 1) == 1 ? data : -1;
+}
+
+int ResumableTlsClient::read(uint8_t *buf, size_t size) {
+  if (size == 0)
+    return 0;
+  int n = 0;
+  if (_peeked >= 0) {
+    buf[n++] = _peeked;
+    _peeked = -1;
+  }
+  // Like WiFiClient: only what is there, -1 when nothing is
+  int ready = _tls ? available() : 0;
+  if (ready > 0 && (size_t)n < size) {
+    int decrypted = mbedtls_ssl_read(&_ssl, buf + n, min((size_t)ready, size - n));
+    if (decrypted > 0)
+      n += decrypted;
+  }
+  return n > 0 ? n : -1;
+}
+
+int ResumableTlsClient::peek() {
+  if (_peeked < 0 && available() > 0) {
+    uint8_t data;
+    if (_tls && mbedtls_ssl_read(&_ssl, &data, 1) == 1)
+      _peeked = data;
+  }
+  return _peeked;
+}
+
+void ResumableTlsClient::flush() {}
+
+uint8_t ResumableTlsClient::connected() {
+  if (!_tls)
+    return _peeked >= 0;
+  return _peeked >= 0 || mbedtls_ssl_get_bytes_avail(&_ssl) > 0 || WiFiClient::connected();
+}
+
+void ResumableTlsClient::stop() {
+  if (_tls)
+    mbedtls_ssl_close_notify(&_ssl);
+  freeTls();
+  WiFiClient::stop();
+}
+
+void ResumableTlsClient::freeTls() {
+  if (!_tls)
+    return;
+  mbedtls_ssl_free(&_ssl);
+  mbedtls_ssl_config_free(&_config);
+  mbedtls_ctr_drbg_free(&_drbg);
+  mbedtls_entropy_free(&_entropy);
+  _tls = false;
+}
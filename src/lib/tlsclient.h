@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/ssl.h"
+#include "os_config.h"
+#include "profile.h"
+#include "rtcmagic.h"
+
+#define TLS_CACHE_MAGIC  RTC_MAGIC('T', 'L', 'S', '2')
+// Largest serialised session that is kept, the session ID or ticket and the keys (the certificate is left out)
+#define TLS_SESSION_SIZE 512
+// Socket timeout for the handshake and the reads and writes after it
+#define TLS_TIMEOUT_MS   5000
+
+/**
+ * HTTPS client that resumes the TLS session of the previous wake
+ *
+ * A full TLS handshake (key exchange, certificate) takes the most CPU time and round trips of a WiFi session. After
+ * a handshake the session (ticket or session ID) is serialised into RTC memory together with the address the host
+ * name resolved to, the next connection skips the DNS lookup and offers the session to the server, which then only
+ * needs an abbreviated handshake. A server that no longer knows the session falls back to a full handshake by
+ * itself. When the cached address does not answer or the handshake on it fails, the name is looked up again.
+ *
+ * It is a WiFiClient, so HTTPClient can use it: http.begin(client, url). Like HTTPClient without a CA certificate
+ * the server certificate is not verified, the watch has no CA store.
+ */
+class ResumableTlsClient : public WiFiClient {
+public:
+  ResumableTlsClient();
+  ~ResumableTlsClient();
+
+  int connect(IPAddress ip, uint16_t port) override;
+  int connect(IPAddress ip, uint16_t port, int32_t timeout) override;
+  int connect(const char *host, uint16_t port) override;
+  int connect(const char *host, uint16_t port, int32_t timeout) override;
+  size_t write(uint8_t data) override;
+  size_t write(const uint8_t *buf, size_t size) override;
+  int available() override;
+  int read() override;
+  int read(uint8_t *buf, size_t size) override;
+  int peek() override;
+  void flush() override;
+  void stop() override;
+  uint8_t connected() override;
+
+private:
+  bool handshake(const char *host);
+  void freeTls();
+
+  bool _tls;   // The TLS context is set up
+  int _peeked; // Byte returned by peek() and not read yet, -1 when there is none
+  int _socket; // Of the WiFiClient, the TLS records go over it
+  mbedtls_ssl_context _ssl;
+  mbedtls_ssl_config _config;
+  mbedtls_entropy_context _entropy;
+  mbedtls_ctr_drbg_context _drbg;
+};
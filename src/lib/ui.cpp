@@ -1,22 +1,132 @@
 #include "ui.h"
 
-void printLeftString(GxEPD_Class *display, const char *buf, int x, int y) {
-  display->setCursor(x, y);
-  display->print(buf);
-}
-
-void printRightString(GxEPD_Class *display, const char *buf, int x, int y) {
-  int16_t x1, y1;
-  uint16_t w, h;
-  display->getTextBounds(buf, x, y, &x1, &y1, &w, &h);
-  display->setCursor(x - w, y);
-  display->print(buf);
-}
-
-void printCenterString(GxEPD_Class *display, const char *buf, int x, int y) {
-  int16_t x1, y1;
-  uint16_t w, h;
-  display->getTextBounds(buf, x, y, &x1, &y1, &w, &h);
-  display->setCursor(x - w / 2, y);
-  display->print(buf);
-}
\ No newline at end of file
+TextRun::TextRun(const GFXfont *font, const char *text) : TextRun(font, text, false) {}
+
+TextRun::TextRun(const RleFont *font, const char *text) : TextRun(&font->gfx, text, true) {}
+
+TextRun::TextRun(const GFXfont *font, const char *text, bool compressed)
+    : _font(font), _compressed(compressed), _count(0), _minX(0x7FFF), _minY(0x7FFF), _maxX(-1), _maxY(-1) {
+  uint8_t first = pgm_read_byte(&font->first);
+  uint8_t last = pgm_read_byte(&font->last);
+  const GFXglyph *glyphs = font->glyph;
+
+  int16_t cursor = 0;
+  for (const char *c = text; *c && _count < TEXT_RUN_MAX_GLYPHS; c++) {
+    uint8_t code = *c;
+    // Like print() we skip what is not in the font, newlines are not supported
+    if (code < first || code > last)
+      continue;
+
+    const GFXglyph *glyph = &glyphs[code - first];
+    uint8_t w = pgm_read_byte(&glyph->width);
+    uint8_t h = pgm_read_byte(&glyph->height);
+    // Same bounds as charBounds(), empty glyphs (space) count as well
+    int16_t x1 = cursor + (int8_t)pgm_read_byte(&glyph->xOffset);
+    int16_t y1 = (int8_t)pgm_read_byte(&glyph->yOffset);
+    _minX = min(_minX, x1);
+    _minY = min(_minY, y1);
+    _maxX = max(_maxX, (int16_t)(x1 + w - 1));
+    _maxY = max(_maxY, (int16_t)(y1 + h - 1));
+    if (w > 0 && h > 0) {
+      _glyphs[_count] = glyph;
+      _positions[_count] = cursor;
+      _count++;
+    }
+    cursor += pgm_read_byte(&glyph->xAdvance);
+  }
+}
+
+void TextRun::draw(Adafruit_GFX *display, int16_t x, int16_t y, uint16_t color) const {
+  display->startWrite();
+  for (uint8_t i = 0; i < _count; i++) {
+    const GFXglyph *glyph = _glyphs[i];
+    int16_t gx = x + _positions[i] + (int8_t)pgm_read_byte(&glyph->xOffset);
+    int16_t gy = y + (int8_t)pgm_read_byte(&glyph->yOffset);
+    if (_compressed) {
+      drawRuns(display, glyph, gx, gy, color);
+    } else {
+      drawBits(display, glyph, gx, gy, color);
+    }
+  }
+  display->endWrite();
+}
+
+/**
+ * Draw a glyph of a GFXfont with its top left corner at x, y
+ */
+void TextRun::drawBits(Adafruit_GFX *display, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t color) const {
+  const uint8_t *src = _font->bitmap + pgm_read_word(&glyph->bitmapOffset);
+  uint8_t w = pgm_read_byte(&glyph->width);
+  uint8_t h = pgm_read_byte(&glyph->height);
+
+  // The glyph bits are one continuous stream, rows are not padded to whole bytes
+  uint8_t bits = 0;
+  uint8_t mask = 0;
+  for (uint8_t yy = 0; yy < h; yy++) {
+    for (uint8_t xx = 0; xx < w; xx++) {
+      if (!mask) {
+        bits = pgm_read_byte(src++);
+        mask = 0x80;
+      }
+      if (bits & mask)
+        display->writePixel(x + xx, y + yy, color);
+      mask >>= 1;
+    }
+  }
+}
+
+/**
+ * Draw a glyph of a RleFont with its top left corner at x, y
+ * The runs alternate between background and ink (starting with background) and go down the columns of the glyph
+ */
+void TextRun::drawRuns(Adafruit_GFX *display, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t color) const {
+  const uint8_t *src = _font->bitmap + pgm_read_word(&glyph->bitmapOffset);
+  uint8_t w = pgm_read_byte(&glyph->width);
+  uint8_t h = pgm_read_byte(&glyph->height);
+
+  // Position of the next pixel in the glyph
+  uint8_t column = 0;
+  uint16_t row = 0;
+  bool ink = false;
+  while (column < w) {
+    uint16_t length = pgm_read_byte(src++);
+    if (ink) {
+      // An ink run can continue in the next column
+      while (length > 0) {
+        uint16_t span = min(length, (uint16_t)(h - row));
+        display->writeFastVLine(x + column, y + row, span, color);
+        length -= span;
+        row += span;
+        if (row == h) {
+          row = 0;
+          column++;
+        }
+      }
+    } else {
+      row += length;
+      column += row / h;
+      row %= h;
+    }
+    ink = !ink;
+  }
+}
+
+void printLeftString(Adafruit_GFX *display, const GFXfont *font, const char *buf, int x, int y, uint16_t color) {
+  TextRun run(font, buf);
+  run.draw(display, x, y, color);
+}
+
+void printRightString(Adafruit_GFX *display, const GFXfont *font, const char *buf, int x, int y, uint16_t color) {
+  TextRun run(font, buf);
+  run.draw(display, x - run.width(), y, color);
+}
+
+void printCenterString(Adafruit_GFX *display, const GFXfont *font, const char *buf, int x, int y, uint16_t color) {
+  TextRun run(font, buf);
+  run.draw(display, x - run.width() / 2, y, color);
+}
+
+void printCenterString(Adafruit_GFX *display, const RleFont *font, const char *buf, int x, int y, uint16_t color) {
+  TextRun run(font, buf);
+  run.draw(display, x - run.width() / 2, y, color);
+}
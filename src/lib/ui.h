@@ -4,6 +4,51 @@
 #include "GxEPD.h"
 #include <GxDEPG0150BN/GxDEPG0150BN.h> // 1.54" b/w 200x200
 
-void printLeftString(GxEPD_Class *display, const char *buf, int x, int y);
-void printRightString(GxEPD_Class *display, const char *buf, int x, int y);
-void printCenterString(GxEPD_Class *display, const char *buf, int x, int y);
\ No newline at end of file
+// Glyphs kept by a TextRun, anything after this is dropped (at the font sizes we use that is far off the screen)
+#define TEXT_RUN_MAX_GLYPHS 48
+
+// A GFX font with run length encoded glyphs (fontconvert -r, tools/compress_font.py), the glyph table is the
+// one of the GFXfont, the bitmap holds the runs. Can only be drawn by a TextRun, never pass it to setFont().
+struct RleFont {
+  GFXfont gfx;
+};
+
+/**
+ * A line of text laid out with a GFX font
+ *
+ * The glyphs are looked up and positioned once when the run is created, the bounds come out of the same pass.
+ * Aligning and drawing the text then works on the resolved run, instead of walking the font once in
+ * getTextBounds() and again in print(). Draws exactly the pixels print() draws with text size 1 and no wrapping.
+ *
+ * The glyphs of a RleFont are decoded while drawing, every ink run becomes one vertical line which is a single
+ * span of the framebuffer in the orientation of the watch.
+ */
+class TextRun {
+public:
+  TextRun(const GFXfont *font, const char *text);
+  TextRun(const RleFont *font, const char *text);
+
+  // Size of the bounding box of the ink, same as getTextBounds() gives
+  uint16_t width() const { return _maxX >= _minX ? _maxX - _minX + 1 : 0; }
+  uint16_t height() const { return _maxY >= _minY ? _maxY - _minY + 1 : 0; }
+
+  // Draw the run with the cursor (start of the baseline) at x, y
+  void draw(Adafruit_GFX *display, int16_t x, int16_t y, uint16_t color) const;
+
+private:
+  TextRun(const GFXfont *font, const char *text, bool compressed);
+  void drawBits(Adafruit_GFX *display, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t color) const;
+  void drawRuns(Adafruit_GFX *display, const GFXglyph *glyph, int16_t x, int16_t y, uint16_t color) const;
+
+  const GFXfont *_font;
+  bool _compressed;
+  const GFXglyph *_glyphs[TEXT_RUN_MAX_GLYPHS];
+  int16_t _positions[TEXT_RUN_MAX_GLYPHS]; // Cursor x of every glyph, relative to the start of the run
+  uint8_t _count;
+  int16_t _minX, _minY, _maxX, _maxY;
+};
+
+void printLeftString(Adafruit_GFX *display, const GFXfont *font, const char *buf, int x, int y, uint16_t color);
+void printRightString(Adafruit_GFX *display, const GFXfont *font, const char *buf, int x, int y, uint16_t color);
+void printCenterString(Adafruit_GFX *display, const GFXfont *font, const char *buf, int x, int y, uint16_t color);
+void printCenterString(Adafruit_GFX *display, const RleFont *font, const char *buf, int x, int y, uint16_t color);
@@ -0,0 +1,49 @@
+#include "weatherjson.h"
+
+#define WEATHER_HOUR_PATH "forecast.forecastday[].hour[]."
+
+static void copyValue(char *field, size_t size, const char *value) {
+  strncpy(field, value, size - 1);
+  field[size - 1] = '\0';
+}
+
+void weatherJsonBegin(WeatherResponse *response, time_t now) {
+  memset(response, 0, sizeof(*response));
+  response->fromHour = now / 3600;
+  response->hour = -1;
+}
+
+/**
+ * A field of an hour of the forecast, time_epoch comes first in every hour and starts the next entry
+ */
+static void forecastValue(WeatherResponse *response, const char *field, const char *value) {
+  if (strcmp(field, "time_epoch") == 0) {
+    uint32_t hour = atol(value) / 3600;
+    response->hour = -1;
+    if (hour >= response->fromHour && response->count < FORECAST_HOURS) {
+      response->hour = response->count++;
+      response->hours[response->hour].hour = hour;
+    }
+    return;
+  }
+  if (response->hour < 0)
+    return;
+
+  ForecastHour &entry = response->hours[response->hour];
+  if (strcmp(field, "temp_c") == 0)
+    entry.tempDeciCelsius = (int16_t)lround(atof(value) * 10);
+  else if (strcmp(field, "condition.code") == 0)
+    entry.condition = (entry.condition & FORECAST_NIGHT_BIT) | (uint16_t)atoi(value);
+  else if (strcmp(field, "is_day") == 0 && atoi(value) == 0)
+    entry.condition |= FORECAST_NIGHT_BIT;
+}
+
+void weatherJsonValue(void *context, const char *path, const char *value) {
+  WeatherResponse *response = (WeatherResponse *)context;
+  if (strncmp(path, WEATHER_HOUR_PATH, sizeof(WEATHER_HOUR_PATH) - 1) == 0)
+    forecastValue(response, path + sizeof(WEATHER_HOUR_PATH) - 1, value);
+  else if (strcmp(path, "current.condition.text") == 0)
+    copyValue(response->condition, sizeof(response->condition), value);
+  else if (strcmp(path, "current.temp_c") == 0)
+    copyValue(response->temp, sizeof(response->temp), value);
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Arduino.h"
+#include "forecast.h"
+#include "hotstate.h"
+#include "jsonstream.h"
+
+// Bytes read from the response at a time, the body is never held as a whole
+#define WEATHER_READ_CHUNK      128
+// The response is given up when no data arrives for this long
+#define WEATHER_READ_TIMEOUT_MS 5000
+
+// The fields of the weather API response the watch shows
+struct WeatherResponse {
+  char condition[HOT_STATE_WEATHER_SIZE]; // current.condition.text
+  char temp[HOT_STATE_TEMP_SIZE];         // current.temp_c
+  uint32_t fromHour;                      // Forecast hours before this one (hours since the epoch) are skipped
+  uint8_t count;                          // Forecast hours collected
+  int8_t hour;                            // Index of the forecast hour being read, -1 while it is skipped
+  ForecastHour hours[FORECAST_HOURS];     // forecast.forecastday[].hour[]
+};
+
+// Start a response, the forecast is collected from the hour of now on
+void weatherJsonBegin(WeatherResponse *response, time_t now);
+// JsonStream callback that fills the WeatherResponse passed as the context, everything else is skipped
+void weatherJsonValue(void *context, const char *path, const char *value);
@@ -8,9 +8,13 @@
 #include "HTTPClient.h"
 #include "Preferences.h"
 #include "WiFi.h"
+#include "esp_timer.h"
 #include "home.h"
 #include "lib/battery.h"
 #include "lib/log.h"
+#include "lib/profile.h"
+#include "lib/renderer.h"
+#include "lib/timekeeper.h"
 #include "os_config.h"
 #include "soc/rtc_cntl_reg.h"
 #include "soc/soc.h"
@@ -19,8 +23,17 @@
 
 using namespace ace_button;
 
+// Events the main loop waits for, delivered to it as task notification bits
+#define LOOP_EVENT_TIMER  (1 << 0) // Another second of the UI timer passed
+#define LOOP_EVENT_BUTTON (1 << 1) // A button event was handled
+
+// Time the button has to be released before we stop polling it, longer than AceButton's double click delay
+#define BUTTON_IDLE_MS    1000
+
 GxIO_Class io(SPI, /*CS*/ EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RESET);
 GxEPD_Class display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY);
+// All drawing goes into the canvas of the renderer, it only pushes the changed areas to the display
+FrameRenderer renderer(&display);
 
 // ESP32Time rtc;
 // ESP32Time rtc(GMT_OFFSET_SEC); // offset in seconds GMT+1
@@ -41,24 +54,91 @@ AwakeState awakeState = AwakeState::APPS_MENU;
 uint32_t sleepTimer = 0;
 
 AceButton button(PIN_KEY);
+TaskHandle_t buttonTaskHandle = NULL;
+TaskHandle_t loopTaskHandle = NULL;
 void buttonUpdateTask(void *pvParameters);
 void focusTimerTask(void *pvParameters);
 void handleButtonEvent(AceButton *button, uint8_t eventType, uint8_t buttonState);
 void performFirstBootActions();
+void bootInteractive();
+void bootTimerWake();
+void configTimeZone();
+void handleLoopState();
+
+// The UI timer is an esp_timer, its callback only wakes the loop
+esp_timer_handle_t uiTimer = NULL;
+
+// Wake the main loop
+void notifyLoop(uint32_t event) {
+  if (loopTaskHandle != NULL)
+    xTaskNotify(loopTaskHandle, event, eSetBits);
+}
 
-hw_timer_t *uiTimer = NULL;
-volatile SemaphoreHandle_t timerSemaphore;
-
-void ARDUINO_ISR_ATTR onTimer() { xSemaphoreGiveFromISR(timerSemaphore, NULL); }
+void onTimer(void *arg) { notifyLoop(LOOP_EVENT_TIMER); }
 
-// Asynchronous event handler when WiFi is connected
-void WiFiConnected(WiFiEvent_t event, WiFiEventInfo_t info) {
-  log(LogLevel::INFO, "WiFi connected, attempting to sync time with ntp server");
-  // configTime(GMT_OFFSET_SEC, DAY_LIGHT_OFFSET_SEC, NTP_SERVER1);
-  log(LogLevel::INFO, "Time synchronized from WiFi");
+// The button interrupt is level triggered, it is muted until the button task has seen the press through, otherwise
+// it would keep firing while the button is held down
+void ARDUINO_ISR_ATTR onButton() {
+  gpio_intr_disable((gpio_num_t)PIN_KEY);
+  BaseType_t woken = pdFALSE;
+  vTaskNotifyGiveFromISR(buttonTaskHandle, &woken);
+  if (woken)
+    portYIELD_FROM_ISR();
 }
 
 void setup() {
+  profileBeginWake();
+  // Before anything reads the time
+  timekeeperBegin();
+
+  // The minute timer wakes only redraw the clock and go straight back to sleep, they take the short way
+  if (wakeup == WakeupFlag::WAKEUP_LIGHT && esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER) {
+    bootTimerWake();
+  } else {
+    bootInteractive();
+  }
+  // The values every wake needs, from RTC memory (or NVS after a power loss)
+  hotStateBegin(&preferences);
+
+  {
+    PROFILE_SCOPE(ProfileStage::DISPLAY_INIT);
+    display.init();
+  }
+  log(LogLevel::SUCCESS, "Display initiliazed");
+
+  switch (wakeup) {
+    // Power on the device and initialize the display, pull time via WiFi
+  case WakeupFlag::WAKEUP_INIT:
+    wakeupInit(&wakeup, &wakeupCount, &display, &renderer, &rtc, &preferences);
+    break;
+
+    // Refresh the time and sleep
+  case WakeupFlag::WAKEUP_LIGHT:
+    wakeupLight(&wakeup, &wakeupCount, &display, &renderer, &rtc, &preferences);
+    // xTaskCreate(buttonUpdateTask, "ButtonUpdateTask", 10000, NULL, 1, NULL);
+    // Listen for when the focus timer ends and set off the alarm
+    break;
+
+    // Wake the device from deep sleep when the button is pressed
+  case WakeupFlag::WAKEUP_DEEP_SLEEP:
+    wakeupDeepSleep(&wakeup, &wakeupCount, &display, &renderer, &rtc, &preferences);
+    break;
+  }
+
+  // Listen for action on the user button (pin 35)
+  xTaskCreate(buttonUpdateTask, "ButtonUpdateTask", 10000, NULL, 1, &buttonTaskHandle);
+  attachInterrupt(PIN_KEY, onButton, ONLOW);
+  // Listen for when the focus timer ends and set off the alarm
+  //  xTaskCreate(focusTimerTask, "FocusTimerTask", 20000, NULL, 10, NULL);
+
+  log(LogLevel::SUCCESS, "Wakeup process completed");
+}
+
+/**
+ * Bring up everything for a wake that stays awake: power on, button presses and resets
+ */
+void bootInteractive() {
+  PROFILE_SCOPE(ProfileStage::BOOT);
   Serial.begin(115200);
   delay(10);
   log(LogLevel::INFO, "Welcome to Lilygo Paper Watch!");
@@ -82,10 +162,6 @@ void setup() {
   // buttonConfig->setDebounceDelay(10);
   buttonConfig->setLongPressDelay(1000);
 
-  pinMode(BAT_ADC, ANALOG);
-  adcAttachPin(BAT_ADC);
-  analogReadResolution(12);
-  analogSetWidth(50);
   log(LogLevel::SUCCESS, "Hardware pins initiliazed");
 
   // The button has been pressed to wake up the device
@@ -101,58 +177,91 @@ void setup() {
   // Perform an actions when the devices is reset or first powered on
   performFirstBootActions();
 
-  // When the wifi is connected, pull the time from the ntp server
-  WiFi.onEvent(WiFiConnected, WiFiEvent_t::ARDUINO_EVENT_WIFI_STA_CONNECTED);
-
-  timerSemaphore = xSemaphoreCreateBinary();
-  uiTimer = timerBegin(0, 80, true);
-  timerAttachInterrupt(uiTimer, &onTimer, true);
-  timerAlarmWrite(uiTimer, 1000000, true);
-  timerAlarmEnable(uiTimer);
-  log(LogLevel::SUCCESS, "Hardware timer initiliazed");
+  // The loop task runs setup() as well
+  loopTaskHandle = xTaskGetCurrentTaskHandle();
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = &onTimer;
+  timerArgs.name = "ui";
+  esp_timer_create(&timerArgs, &uiTimer);
+  esp_timer_start_periodic(uiTimer, 1000000);
+  log(LogLevel::SUCCESS, "UI timer initiliazed");
 
   //  We can manually set the time, but not a good idea gets called with every cycle
   // rtc.setTime(00, 40, 21, 13, 1, 2024); // 17th Jan 2021 15:24:30
 
-  configTime(GMT_OFFSET_SEC, DAY_LIGHT_OFFSET_SEC, nullptr);
+  configTimeZone();
   log(LogLevel::SUCCESS, "Time configured");
+}
 
-  display.init();
-  display.setRotation(1);
-  log(LogLevel::SUCCESS, "Display initiliazed");
+/**
+ * Minimal boot for the minute timer wakes
+ *
+ * wakeupLight() draws the new minute with partial updates and puts the device back into deep sleep, it needs
+ * nothing but the display (SPI + EPD), the preferences and the timezone. The serial port, the button, the WiFi
+ * events and the UI timer are left to bootInteractive(), the battery ADC is set up when it is measured.
+ * The serial port is not started, so these wakes do not log.
+ */
+void bootTimerWake() {
+  PROFILE_SCOPE(ProfileStage::BOOT);
+  SPI.begin(SPI_SCK, -1, SPI_DIN, EPD_CS);
 
-  switch (wakeup) {
-    // Power on the device and initialize the display, pull time via WiFi
-  case WakeupFlag::WAKEUP_INIT:
-    wakeupInit(&wakeup, &wakeupCount, &display, &rtc, &preferences);
-    break;
+  // Turn off the motor pin (It appears to turn on after deep sleep)
+  digitalWrite(PIN_MOTOR, LOW);
 
-    // Refresh the time and sleep
-  case WakeupFlag::WAKEUP_LIGHT:
-    wakeupLight(&wakeup, &wakeupCount, &display, &rtc, &preferences);
-    // xTaskCreate(buttonUpdateTask, "ButtonUpdateTask", 10000, NULL, 1, NULL);
-    // Listen for when the focus timer ends and set off the alarm
-    break;
+  pinMode(PWR_EN, OUTPUT);
+  digitalWrite(PWR_EN, HIGH);
 
-    // Wake the device from deep sleep when the button is pressed
-  case WakeupFlag::WAKEUP_DEEP_SLEEP:
-    wakeupDeepSleep(&wakeup, &wakeupCount, &display, &rtc, &preferences);
-    break;
-  }
+  preferences.begin(PREFS_KEY);
 
-  // Listen for action on the user button (pin 35)
-  xTaskCreate(buttonUpdateTask, "ButtonUpdateTask", 10000, NULL, 1, NULL);
-  // Listen for when the focus timer ends and set off the alarm
-  //  xTaskCreate(focusTimerTask, "FocusTimerTask", 20000, NULL, 10, NULL);
+  // ESP32Time reads the local time, the RTC keeps the UTC time through deep sleep but the timezone is gone
+  configTimeZone();
+}
 
-  log(LogLevel::SUCCESS, "Wakeup process completed");
+/**
+ * Set the timezone the same way configTime() does, without starting SNTP (the time comes from ntpQueryServers())
+ */
+void configTimeZone() {
+  long offset = -GMT_OFFSET_SEC; // POSIX offsets are west of UTC
+  long dstOffset = offset - DAY_LIGHT_OFFSET_SEC;
+  char tz[40];
+  snprintf(tz, sizeof(tz), "UTC%c%ld:%02ld:%02ldDST%c%ld:%02ld:%02ld", offset < 0 ? '-' : '+', labs(offset) / 3600,
+           labs(offset) % 3600 / 60, labs(offset) % 60, dstOffset < 0 ? '-' : '+', labs(dstOffset) / 3600, labs(dstOffset) % 3600 / 60,
+           labs(dstOffset) % 60);
+  setenv("TZ", tz, 1);
+  tzset();
 }
 
 // Event loop
 void loop() {
-  if (xSemaphoreTake(timerSemaphore, 0) == pdTRUE)
+  // Block until the timer, the button or the network has something for us
+  uint32_t events = 0;
+  {
+    PROFILE_SCOPE(ProfileStage::LOOP_IDLE);
+    xTaskNotifyWait(0, ULONG_MAX, &events, portMAX_DELAY);
+  }
+
+  if (events & LOOP_EVENT_TIMER)
     sleepTimer++;
 
+  // Print the timings of the last wakes, or of the CPU phases per frequency
+  if (Serial.available()) {
+    char command = Serial.read();
+    if (command == 'p')
+      profileDump();
+    else if (command == 'g')
+      governorDump();
+  }
+
+  // A state can hand over to another one (deep sleep -> light), the new state has to see the same second
+  WakeupFlag state;
+  do {
+    state = wakeup;
+    handleLoopState();
+  } while (wakeup != state);
+}
+
+// Run the loop part of the current wakeup state
+void handleLoopState() {
   switch (wakeup) {
 
     // Power on the device and initialize the display, pull time via WiFi
@@ -174,8 +283,19 @@ void loop() {
 
 void buttonUpdateTask(void *pvParameters) {
   while (1) {
-    button.check();
-    vTaskDelay(10);
+    // Sleep until the button is pressed
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // AceButton detects clicks, double clicks and long presses by polling, keep polling until the button has
+    // been released long enough that no event can follow
+    uint32_t releasedAt = millis();
+    while (digitalRead(PIN_KEY) == 0 || millis() - releasedAt < BUTTON_IDLE_MS) {
+      if (digitalRead(PIN_KEY) == 0)
+        releasedAt = millis();
+      button.check();
+      vTaskDelay(10);
+    }
+    gpio_intr_enable((gpio_num_t)PIN_KEY);
   }
   Serial.println("Ending task 1");
   vTaskDelete(NULL);
@@ -207,11 +327,10 @@ void handleButtonEvent(AceButton *button, uint8_t eventType, uint8_t buttonState
   switch (eventType) {
   case AceButton::kEventClicked: {
     Serial.println("Clicked");
-    // Let us start focus time if not already running. Get the focus time from the preferences
-    int time = preferences.getInt("focus_time", 0);
-    if (time <= 0) {
+    // Let us start focus time if not already running
+    if (hotState().focusTime <= 0) {
       // Start the focus time to 25 minutes
-      preferences.putInt("focus_time", 25);
+      hotStateSetFocusTime(25);
     }
     break;
   }
@@ -220,8 +339,8 @@ void handleButtonEvent(AceButton *button, uint8_t eventType, uint8_t buttonState
   case AceButton::kEventDoubleClicked:
     Serial.println("Double Clicked, setting focus timer to 5 minutes");
     // Reset the focus timer
-    preferences.putInt("focus_time", 5);
-    wakeupDeepSleep(&wakeup, &wakeupCount, &display, &rtc, &preferences);
+    hotStateSetFocusTime(5);
+    wakeupDeepSleep(&wakeup, &wakeupCount, &display, &renderer, &rtc, &preferences);
     break;
 
     // Long press to turn off the focus timer
@@ -230,11 +349,13 @@ void handleButtonEvent(AceButton *button, uint8_t eventType, uint8_t buttonState
     // Turn off the focus timer
     // We need to set the focus time to 99, so that the focus timer does not start again
     // when we make a call to wakeupDeepSleep
-    preferences.putInt("focus_time", 99);
+    hotStateSetFocusTime(99);
     // refresh the display
-    wakeupDeepSleep(&wakeup, &wakeupCount, &display, &rtc, &preferences);
+    wakeupDeepSleep(&wakeup, &wakeupCount, &display, &renderer, &rtc, &preferences);
     break;
   }
+
+  notifyLoop(LOOP_EVENT_BUTTON);
 }
 
 /**
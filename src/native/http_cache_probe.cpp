@@ -0,0 +1,158 @@
+/**
+ * Check the conditional weather requests on the host
+ *
+ * Built by the native_http environment only (pio run -e native_http). A stand-in for the weather API on localhost
+ * answers with an ETag, a Last-Modified and a max-age, and with a 304 when the request carries the current ETag.
+ * A minimal HTTP/1.0 client stands in for HTTPClient and goes through the same httpcache calls as getWeather(),
+ * on a clock of its own, so that the max-age can run out without waiting for it.
+ *
+ * Usage: .pio/build/native_http/program
+ */
+#include "lib/httpcache.h"
+#include <arpa/inet.h>
+#include <atomic>
+#include <netinet/in.h>
+#include <string>
+#include <strings.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+#define PROBE_MAX_AGE_S 600
+#define PROBE_BODY_SIZE 33708 // As big as the recorded forecast response
+
+static std::atomic<int> serverVersion(1);
+
+static std::string header(const std::string &request, const char *name) {
+  std::string lower = request;
+  for (char &c : lower)
+    c = tolower(c);
+  std::string key = std::string("\r\n") + name + ":";
+  for (char &c : key)
+    c = tolower(c);
+  size_t start = lower.find(key);
+  if (start == std::string::npos)
+    return "";
+  start += key.size();
+  while (request[start] == ' ')
+    start++;
+  return request.substr(start, request.find("\r\n", start) - start);
+}
+
+/**
+ * Answer like the weather API would, if it sent validators
+ */
+static void serve(int listener) {
+  int client;
+  while ((client = accept(listener, NULL, NULL)) >= 0) {
+    std::string request;
+    char buffer[512];
+    ssize_t n;
+    while (request.find("\r\n\r\n") == std::string::npos && (n = recv(client, buffer, sizeof(buffer), 0)) > 0)
+      request.append(buffer, n);
+
+    std::string etag = "\"v" + std::to_string(serverVersion) + "\"";
+    bool notModified = header(request, "If-None-Match") == etag;
+    std::string response = std::string(notModified ? "HTTP/1.0 304 Not Modified\r\n" : "HTTP/1.0 200 OK\r\n") +
+                           "Content-Type: application/json\r\n"
+                           "ETag: " +
+                           etag + "\r\nLast-Modified: Thu, 17 Oct 2024 10:30:00 GMT\r\nCache-Control: public, max-age=" +
+                           std::to_string(PROBE_MAX_AGE_S) + "\r\n\r\n";
+    if (!notModified)
+      response += "{\"pad\":\"" + std::string(PROBE_BODY_SIZE - 10, 'x') + "\"}";
+    send(client, response.data(), response.size(), 0);
+    close(client);
+  }
+}
+
+/**
+ * One weather request the way getWeather() makes it, returns the status (0 when it was not made at all)
+ */
+static int request(Preferences *preferences, uint16_t port, const char *url, time_t now, size_t *received) {
+  *received = 0;
+  if (httpCacheFresh(preferences, url, now))
+    return 0;
+
+  String ifNoneMatch, ifModifiedSince;
+  httpCacheConditions(preferences, url, &ifNoneMatch, &ifModifiedSince);
+  std::string request = std::string("GET ") + url + " HTTP/1.0\r\nHost: localhost\r\n";
+  if (ifNoneMatch.length() > 0)
+    request += std::string("If-None-Match: ") + ifNoneMatch.c_str() + "\r\n";
+  if (ifModifiedSince.length() > 0)
+    request += std::string("If-Modified-Since: ") + ifModifiedSince.c_str() + "\r\n";
+  request += "\r\n";
+
+  int sock = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(port);
+  if (connect(sock, (struct sockaddr *)&address, sizeof(address)) != 0) {
+    close(sock);
+    return -1;
+  }
+  send(sock, request.data(), request.size(), 0);
+  std::string response;
+  char buffer[1024];
+  ssize_t n;
+  while ((n = recv(sock, buffer, sizeof(buffer), 0)) > 0)
+    response.append(buffer, n);
+  close(sock);
+
+  *received = response.size();
+  int status = atoi(response.c_str() + 9);
+  std::string head = response.substr(0, response.find("\r\n\r\n") + 2);
+  httpCacheUpdate(preferences, url, status, header(head, "ETag").c_str(), header(head, "Last-Modified").c_str(),
+                  header(head, "Cache-Control").c_str(), header(head, "Age").c_str(), now);
+  return status;
+}
+
+int main() {
+  int listener = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  socklen_t length = sizeof(address);
+  if (listener < 0 || bind(listener, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(listener, 4) != 0 ||
+      getsockname(listener, (struct sockaddr *)&address, &length) != 0) {
+    printf("Cannot open the stand-in server\n");
+    return 1;
+  }
+  uint16_t port = ntohs(address.sin_port);
+  std::thread server(serve, listener);
+
+  struct Step {
+    const char *name;
+    const char *url;
+    time_t now;
+    int version;
+    int expected;
+  };
+  static const Step steps[] = {
+      {"first request", "/v1/forecast.json?q=Amsterdam", 1000, 1, 200},
+      {"within max-age", "/v1/forecast.json?q=Amsterdam", 1000 + PROBE_MAX_AGE_S / 2, 1, 0},
+      {"after max-age", "/v1/forecast.json?q=Amsterdam", 1000 + PROBE_MAX_AGE_S * 2, 1, 304},
+      {"again within max-age", "/v1/forecast.json?q=Amsterdam", 1000 + PROBE_MAX_AGE_S * 2 + 1, 1, 0},
+      {"new data", "/v1/forecast.json?q=Amsterdam", 1000 + PROBE_MAX_AGE_S * 4, 2, 200},
+      {"other location", "/v1/forecast.json?q=Utrecht", 1000 + PROBE_MAX_AGE_S * 4 + 1, 2, 200},
+  };
+
+  Preferences preferences;
+  int failures = 0;
+  printf("%-22s %8s %10s\n", "step", "status", "bytes");
+  for (const Step &step : steps) {
+    serverVersion = step.version;
+    size_t received;
+    int status = request(&preferences, port, step.url, step.now, &received);
+    failures += status != step.expected;
+    printf("%-22s %8d %10zu%s\n", step.name, status, received, status != step.expected ? "  UNEXPECTED" : "");
+  }
+
+  shutdown(listener, SHUT_RDWR);
+  server.join();
+  close(listener);
+  printf("%s: %d unexpected answers, NVS writes %lu\n", failures ? "FAIL" : "OK", failures, (unsigned long)preferences.writes);
+  return failures ? 1 : 0;
+}
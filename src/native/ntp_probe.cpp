@@ -0,0 +1,109 @@
+/**
+ * Check the one-shot NTP client on the host
+ *
+ * Built by the native_ntp environment only (pio run -e native_ntp). Without arguments a stand-in server on
+ * localhost answers with the clock of the host moved by a known offset and held back by a known delay each way, the
+ * offset found by ntpQuery() has to match it. With a server name the real server is asked instead.
+ *
+ * Usage: .pio/build/native_ntp/program [server]
+ */
+#include "lib/ntp.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <thread>
+#include <unistd.h>
+
+// What the stand-in server pretends: its clock is ahead by this, the network takes this long each way
+#define PROBE_OFFSET_US  1234567890LL
+#define PROBE_DELAY_US   40000
+// The measured offset may be off by this much (scheduling of the two threads)
+#define PROBE_TOLERANCE  5000
+#define PROBE_QUERIES    5
+
+static int64_t nowUs() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void putTimestamp(uint8_t *buffer, int64_t us) {
+  uint32_t seconds = (uint32_t)(us / 1000000 + NTP_UNIX_OFFSET);
+  uint32_t fraction = (uint32_t)(((uint64_t)(us % 1000000) << 32) / 1000000);
+  for (int i = 0; i < 4; i++) {
+    buffer[i] = seconds >> (24 - 8 * i);
+    buffer[4 + i] = fraction >> (24 - 8 * i);
+  }
+}
+
+/**
+ * Answer requests like a stratum 2 server would, with the network delay simulated on both sides
+ */
+static void serve(int sock, int requests) {
+  for (int i = 0; i < requests; i++) {
+    uint8_t packet[NTP_PACKET_SIZE];
+    struct sockaddr_in client;
+    socklen_t clientLength = sizeof(client);
+    if (recvfrom(sock, packet, sizeof(packet), 0, (struct sockaddr *)&client, &clientLength) != sizeof(packet))
+      continue;
+
+    usleep(PROBE_DELAY_US); // The request is still on its way
+    uint8_t answer[NTP_PACKET_SIZE];
+    memset(answer, 0, sizeof(answer));
+    answer[0] = 0x24; // No leap second, version 4, server mode
+    answer[1] = 2;
+    memcpy(answer + 24, packet + 40, 8); // Originate timestamp: the transmit timestamp of the client
+    putTimestamp(answer + 32, nowUs() + PROBE_OFFSET_US);
+    usleep(1000); // Time spent in the server, the round trip does not count it
+    putTimestamp(answer + 40, nowUs() + PROBE_OFFSET_US);
+    usleep(PROBE_DELAY_US); // The answer is on its way
+    sendto(sock, answer, sizeof(answer), 0, (struct sockaddr *)&client, clientLength);
+  }
+}
+
+static int probeServer(const char *server) {
+  NtpResult result;
+  if (!ntpQuery(server, NTP_PORT, NTP_TIMEOUT_MS, &result))
+    return 1;
+  printf("%s: offset %lld us, round trip %lu us, stratum %d\n", server, (long long)result.offsetUs, (unsigned long)result.rttUs,
+         result.stratum);
+  return 0;
+}
+
+static int probeStandIn() {
+  int sock = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+  socklen_t length = sizeof(address);
+  if (sock < 0 || bind(sock, (struct sockaddr *)&address, sizeof(address)) != 0 || getsockname(sock, (struct sockaddr *)&address, &length) != 0) {
+    printf("Cannot open the stand-in server\n");
+    return 1;
+  }
+  uint16_t port = ntohs(address.sin_port);
+  std::thread server(serve, sock, PROBE_QUERIES);
+
+  int failures = 0;
+  printf("%8s %12s %12s %12s\n", "query", "offset us", "error us", "rtt us");
+  for (int i = 0; i < PROBE_QUERIES; i++) {
+    NtpResult result;
+    if (!ntpQuery("127.0.0.1", port, NTP_TIMEOUT_MS, &result)) {
+      failures++;
+      continue;
+    }
+    int64_t error = result.offsetUs - PROBE_OFFSET_US;
+    if (llabs(error) > PROBE_TOLERANCE)
+      failures++;
+    printf("%8d %12lld %12lld %12lu\n", i, (long long)result.offsetUs, (long long)error, (unsigned long)result.rttUs);
+  }
+  server.join();
+  close(sock);
+
+  printf("%s: %d of %d queries off by more than %d us\n", failures ? "FAIL" : "OK", failures, PROBE_QUERIES, PROBE_TOLERANCE);
+  return failures ? 1 : 0;
+}
+
+int main(int argc, char **argv) { return argc > 1 ? probeServer(argv[1]) : probeStandIn(); }
@@ -0,0 +1,287 @@
+/**
+ * Render the watchfaces on the host and report what they cost
+ *
+ * Built by the native environment only (pio run -e native), the display is the simulated GxEPD from
+ * lib/NativeMocks. Every scenario is rendered once into PBM files (so the result can be looked at) and
+ * then many times to measure the time per render.
+ *
+ * Usage: .pio/build/native/program [output directory]
+ */
+#include "home.h"
+#include "lib/renderer.h"
+#include "os_config.h"
+#include "resources/app_icons.h"
+#include "resources/fonts/Outfit_80036pt7b.h"
+#include <chrono>
+#include <string>
+
+#define BENCH_ITERATIONS 200
+
+/**
+ * Canvas that counts the drawing primitives it receives
+ */
+class CountingCanvas : public WatchCanvas {
+public:
+  CountingCanvas() : WatchCanvas(GxEPD_WIDTH, GxEPD_HEIGHT) {}
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    drawCalls++;
+    pixels++;
+    WatchCanvas::drawPixel(x, y, color);
+  }
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override {
+    drawCalls++;
+    pixels += h;
+    WatchCanvas::drawFastVLine(x, y, h, color);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override {
+    drawCalls++;
+    pixels += w;
+    WatchCanvas::drawFastHLine(x, y, w, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) override {
+    drawCalls++;
+    pixels += w * h;
+    WatchCanvas::fillRect(x, y, w, h, color);
+  }
+  void fillScreen(uint16_t color) override {
+    drawCalls++;
+    pixels += GxEPD_WIDTH * GxEPD_HEIGHT;
+    WatchCanvas::fillScreen(color);
+  }
+
+  uint32_t drawCalls = 0;
+  uint32_t pixels = 0;
+};
+
+typedef void (*RenderFunction)(WatchCanvas *display, ESP32Time *rtc);
+
+static void renderHome(WatchCanvas *display, ESP32Time *rtc) { drawHomeUI(display, rtc, 80); }
+static void renderTime(WatchCanvas *display, ESP32Time *rtc) { displayTime(display, rtc); }
+static void renderWeather(WatchCanvas *display, ESP32Time *rtc) { displayWeather(display, "Partly cloudy", "12.5"); }
+static void renderFocusTime(WatchCanvas *display, ESP32Time *rtc) { displayFocusTime(display, 25); }
+
+static void renderWatchface(WatchCanvas *display, ESP32Time *rtc) {
+  drawHomeUI(display, rtc, 80);
+  displayWeather(display, "Partly cloudy", "12.5");
+  displayFocusTime(display, 25);
+}
+
+/**
+ * Rasterize one scenario into a canvas, report the primitives, pixels and time per render
+ */
+static void benchRaster(const char *name, RenderFunction render, ESP32Time *rtc) {
+  CountingCanvas canvas;
+  canvas.fillScreen(GxEPD_WHITE);
+  canvas.drawCalls = 0;
+  canvas.pixels = 0;
+  render(&canvas, rtc);
+  uint32_t drawCalls = canvas.drawCalls;
+  uint32_t pixels = canvas.pixels;
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    render(&canvas, rtc);
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+  printf("%-22s %10u %12u %12.1f\n", name, drawCalls, pixels, us);
+}
+
+/**
+ * Compare blitBitmap() with the generic Adafruit_GFX::drawBitmap() on an unrotated canvas
+ * Both are run at an aligned and an unaligned x, the results have to be identical
+ */
+static void benchBitmap(const char *name, const uint8_t *bitmap, int16_t w, int16_t h) {
+  GFXcanvas1 generic(GxEPD_WIDTH, GxEPD_HEIGHT);
+  GFXcanvas1 blit(GxEPD_WIDTH, GxEPD_HEIGHT);
+  const int16_t positions[] = {8, 13};
+
+  for (int16_t x : positions) {
+    generic.fillScreen(GxEPD_WHITE);
+    blit.fillScreen(GxEPD_WHITE);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+      generic.drawBitmap(x, 2, bitmap, w, h, GxEPD_BLACK);
+    }
+    double genericUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < BENCH_ITERATIONS; i++) {
+      blitBitmap(&blit, x, 2, bitmap, w, h, GxEPD_BLACK);
+    }
+    double blitUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+    bool same = memcmp(generic.getBuffer(), blit.getBuffer(), FRAME_BUFFER_SIZE) == 0;
+    printf("%-22s %4d %12.2f %12.2f %10s\n", name, x, genericUs, blitUs, same ? "yes" : "NO");
+  }
+}
+
+/**
+ * Center a string the old way (getTextBounds() and then print()) and with a TextRun, the results (and the width
+ * from the font metrics) have to be identical
+ */
+static void benchText(const char *text) {
+  WatchCanvas generic(GxEPD_WIDTH, GxEPD_HEIGHT);
+  WatchCanvas run(GxEPD_WIDTH, GxEPD_HEIGHT);
+  generic.setFont(&Outfit_60011pt7b);
+  generic.setTextColor(GxEPD_BLACK);
+  generic.setTextWrap(false);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    int16_t x1, y1;
+    uint16_t w, h;
+    generic.getTextBounds(text, 100, 158, &x1, &y1, &w, &h);
+    generic.setCursor(100 - w / 2, 158);
+    generic.print(text);
+  }
+  double genericUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    printCenterString(&run, &Outfit_60011pt7b, text, 100, 158, GxEPD_BLACK);
+  }
+  double runUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+  bool same = memcmp(generic.getBuffer(), run.getBuffer(), FRAME_BUFFER_SIZE) == 0;
+  // The constexpr metrics have to give the same width
+  same = same && textWidth(Outfit_60011pt7bMetrics, text) == TextRun(&Outfit_60011pt7b, text).width();
+  printf("%-22s %12.2f %12.2f %10s\n", text, genericUs, runUs, same ? "yes" : "NO");
+}
+
+/**
+ * Draw a string with the bit-packed and with the run length encoded version of the clock font
+ * The canvas is cleared every time, like the time area is on the watch, the results have to be identical
+ */
+static void benchFont(const char *text) {
+  WatchCanvas bits(GxEPD_WIDTH, GxEPD_HEIGHT);
+  WatchCanvas runs(GxEPD_WIDTH, GxEPD_HEIGHT);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    bits.fillScreen(GxEPD_WHITE);
+    printCenterString(&bits, &Outfit_80036pt7b, text, 100, 118, GxEPD_BLACK);
+  }
+  double bitsUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    runs.fillScreen(GxEPD_WHITE);
+    printCenterString(&runs, &Outfit_80036pt7bRle, text, 100, 118, GxEPD_BLACK);
+  }
+  double runsUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+  bool same = memcmp(bits.getBuffer(), runs.getBuffer(), FRAME_BUFFER_SIZE) == 0;
+  printf("%-22s %12.2f %12.2f %10s\n", text, bitsUs, runsUs, same ? "yes" : "NO");
+}
+
+/**
+ * Draw the same mix of primitives (area clears, text, the status icons) into a GFXcanvas1 rotated at runtime
+ * and into the WatchCanvas, the results have to be identical
+ */
+static void drawPrimitives(Adafruit_GFX *canvas) {
+  canvas->fillRect(0, 64, 200, 58, GxEPD_WHITE);
+  canvas->fillRect(0, 138, 200, 28, GxEPD_WHITE);
+  canvas->fillRect(104, 0, 96, 32, GxEPD_WHITE);
+  printCenterString(canvas, &Outfit_60011pt7b, "Sat, October 17", 100, 158, GxEPD_BLACK);
+  canvas->drawFastHLine(10, 130, 180, GxEPD_BLACK);
+}
+
+static void benchCanvas() {
+  GFXcanvas1 generic(GxEPD_WIDTH, GxEPD_HEIGHT);
+  WatchCanvas watch(GxEPD_WIDTH, GxEPD_HEIGHT);
+  generic.setRotation(DISPLAY_ROTATION);
+  generic.fillScreen(GxEPD_BLACK);
+  watch.fillScreen(GxEPD_BLACK);
+
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    drawPrimitives(&generic);
+    generic.drawBitmap(2, 24, icon_wifi_small, 28, 28, GxEPD_BLACK);
+    generic.drawBitmap(170, 2, epd_bitmap_icon_battery_80_small, 28, 28, GxEPD_BLACK);
+  }
+  double genericUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < BENCH_ITERATIONS; i++) {
+    drawPrimitives(&watch);
+    watch.drawRotatedBitmap(2, 24, icon_wifi_small_r1, 28, 28, GxEPD_BLACK);
+    watch.drawRotatedBitmap(170, 2, epd_bitmap_icon_battery_80_small_r1, 28, 28, GxEPD_BLACK);
+  }
+  double watchUs = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / BENCH_ITERATIONS;
+
+  bool same = memcmp(generic.getBuffer(), watch.getBuffer(), FRAME_BUFFER_SIZE) == 0;
+  printf("%-22s %12.2f %12.2f %10s\n", "primitives + icons", genericUs, watchUs, same ? "yes" : "NO");
+}
+
+/**
+ * Run a scenario through the renderer and the simulated display and write the panel to a PBM file
+ */
+static void benchDisplay(const char *name, GxEPD_Class *display, FrameRenderer *renderer, ESP32Time *rtc, bool full, const std::string &out) {
+  display->resetStats();
+  auto start = std::chrono::steady_clock::now();
+  renderWatchface(renderer->canvas(), rtc);
+  if (full) {
+    renderer->flushFull();
+  } else {
+    renderer->flush();
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+  const GxEPDStats &stats = display->stats();
+  printf("%-22s %10u %8u %8u %12u %12.1f\n", name, stats.pixelWrites, stats.fullUpdates, stats.windowUpdates, stats.refreshedPixels, us);
+  display->writePBM((out + "/" + name + ".pbm").c_str());
+}
+
+int main(int argc, char **argv) {
+  std::string out = argc > 1 ? argv[1] : ".";
+
+  GxEPD_Class display;
+  FrameRenderer renderer(&display);
+  ESP32Time rtc(GMT_OFFSET_SEC);
+  rtc.setTime(0, 34, 12, 17, 10, 2026);
+
+  printf("Rasterizing (%d iterations)\n", BENCH_ITERATIONS);
+  printf("%-22s %10s %12s %12s\n", "scenario", "draw calls", "pixels", "us/render");
+  benchRaster("drawHomeUI", renderHome, &rtc);
+  benchRaster("displayTime", renderTime, &rtc);
+  benchRaster("displayWeather", renderWeather, &rtc);
+  benchRaster("displayFocusTime", renderFocusTime, &rtc);
+  benchRaster("watchface", renderWatchface, &rtc);
+
+  printf("\nBitmaps, rotation 0 (%d iterations)\n", BENCH_ITERATIONS);
+  printf("%-22s %4s %12s %12s %10s\n", "bitmap", "x", "generic us", "blit us", "identical");
+  benchBitmap("icon_wifi_small", icon_wifi_small, 28, 28);
+  benchBitmap("battery_80_small", epd_bitmap_icon_battery_80_small, 28, 28);
+  benchBitmap("qpaperos_logo_100", qpaperos_logo_100, 100, 100);
+  benchBitmap("icon_app_about", icon_app_about, 96, 96);
+
+  printf("\nCentered text, getTextBounds() + print() vs TextRun\n");
+  printf("%-22s %12s %12s %10s\n", "text", "generic us", "run us", "identical");
+  benchText("Sat, October 17");
+  benchText("Partly cloudy 12.5C");
+  benchText(" 80% ");
+  benchText("--:--");
+
+  printf("\nClock font, bitmaps %u bytes vs runs %u bytes (%d iterations)\n", (unsigned)sizeof(Outfit_80036pt7bBitmaps),
+         (unsigned)sizeof(Outfit_80036pt7bRuns), BENCH_ITERATIONS);
+  printf("%-22s %12s %12s %10s\n", "text", "bits us", "runs us", "identical");
+  benchFont("12:34");
+  benchFont("20:08");
+  benchFont("ABCxyz%");
+
+  printf("\nRotation %d, runtime (GFXcanvas1) vs compile time (WatchCanvas)\n", DISPLAY_ROTATION);
+  printf("%-22s %12s %12s %10s\n", "scenario", "runtime us", "fixed us", "identical");
+  benchCanvas();
+
+  printf("\nDisplay updates\n");
+  printf("%-22s %10s %8s %8s %12s %12s\n", "scenario", "px writes", "full", "window", "refreshed", "us");
+  benchDisplay("watchface_full", &display, &renderer, &rtc, true, out);
+  rtc.setTime(0, 35, 12, 17, 10, 2026);
+  benchDisplay("watchface_next_minute", &display, &renderer, &rtc, false, out);
+  benchDisplay("watchface_unchanged", &display, &renderer, &rtc, false, out);
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * Parse recorded weather API responses on the host and report what it costs
+ *
+ * Built by the native_weather environment only (pio run -e native_weather). Every payload is parsed the way
+ * getWeather() does it, fed in pieces of a few sizes as they would come from the network, and checked against the
+ * whole-body parse. The heap is counted by replacing the global allocator, the parser itself lives on the stack.
+ *
+ * Usage: .pio/build/native_weather/program [payload.json...] (default: the recordings in src/native/payloads)
+ */
+#include "lib/jsonstream.h"
+#include "lib/weatherjson.h"
+#include <chrono>
+#include <fstream>
+#include <new>
+#include <sstream>
+#include <string>
+
+#define BENCH_ITERATIONS 2000
+
+static size_t heapInUse = 0;
+static size_t heapPeak = 0;
+static size_t heapAllocations = 0;
+
+// Every block carries its size in front, so that the bytes in use can be counted on free
+void *operator new(size_t size) {
+  size_t *block = (size_t *)malloc(size + sizeof(size_t));
+  if (block == NULL)
+    throw std::bad_alloc();
+  *block = size;
+  heapInUse += size;
+  heapPeak = max(heapPeak, heapInUse);
+  heapAllocations++;
+  return block + 1;
+}
+
+void operator delete(void *pointer) noexcept {
+  if (pointer == NULL)
+    return;
+  size_t *block = (size_t *)pointer - 1;
+  heapInUse -= *block;
+  free(block);
+}
+
+void operator delete(void *pointer, size_t) noexcept { operator delete(pointer); }
+
+static bool parse(const std::string &body, size_t chunk, WeatherResponse *weather) {
+  // From the first hour in the recording on, the recordings are older than the clock of the host
+  weatherJsonBegin(weather, 0);
+  JsonStream parser(weatherJsonValue, weather);
+  for (size_t offset = 0; offset < body.size(); offset += chunk)
+    parser.feed(body.data() + offset, min(chunk, body.size() - offset));
+  return parser.done();
+}
+
+static int benchPayload(const char *file) {
+  std::ifstream in(file, std::ios::binary);
+  if (!in) {
+    printf("%s: cannot read\n", file);
+    return 1;
+  }
+  std::stringstream content;
+  content << in.rdbuf();
+  std::string body = content.str();
+
+  WeatherResponse expected;
+  if (!parse(body, body.size(), &expected)) {
+    printf("%s: not parsed\n", file);
+    return 1;
+  }
+  printf("%s: %zu bytes, condition \"%s\", temp %s, %d hours of forecast\n", file, body.size(), expected.condition, expected.temp,
+         expected.count);
+
+  int failures = 0;
+  static const size_t chunks[] = {1, 16, WEATHER_READ_CHUNK, 1024};
+  for (size_t chunk : chunks) {
+    WeatherResponse weather;
+    size_t heapBefore = heapAllocations;
+    heapPeak = heapInUse;
+    auto start = std::chrono::steady_clock::now();
+    bool ok = true;
+    for (int i = 0; i < BENCH_ITERATIONS; i++)
+      ok &= parse(body, chunk, &weather);
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    ok &= memcmp(&weather, &expected, sizeof(weather)) == 0;
+    failures += !ok;
+
+    printf("  chunk %5zu: %8.2f us/parse, %6.1f MB/s, heap allocations %zu, heap peak %zu bytes%s\n", chunk,
+           elapsed / 1000.0 / BENCH_ITERATIONS, body.size() * BENCH_ITERATIONS * 1000.0 / elapsed, heapAllocations - heapBefore,
+           heapPeak - heapInUse, ok ? "" : ", MISMATCH");
+  }
+  return failures;
+}
+
+int main(int argc, char **argv) {
+  static const char *recordings[] = {"src/native/payloads/current.json", "src/native/payloads/current_fr_aqi.json",
+                                     "src/native/payloads/forecast.json"};
+
+  // The parser state is all the memory there is, getString() + StaticJsonDocument<2048> needed the body plus 2 KB
+  printf("Parser state %zu bytes on the stack, read buffer %d bytes\n", sizeof(JsonStream) + sizeof(WeatherResponse),
+         WEATHER_READ_CHUNK);
+  int failures = 0;
+  if (argc > 1) {
+    for (int i = 1; i < argc; i++)
+      failures += benchPayload(argv[i]);
+  } else {
+    for (const char *file : recordings)
+      failures += benchPayload(file);
+  }
+  return failures ? 1 : 0;
+}
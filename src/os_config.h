@@ -18,17 +18,31 @@
 #define EPD_RESET              17
 #define EPD_BUSY               16
 
+// Orientation of the UI on the panel, fixed at compile time (see lib/canvas.h)
+#define DISPLAY_ROTATION       1
+
 // Time Configuration
 #define NTP_SERVER1            "pool.ntp.org"
 #define NTP_SERVER2            "time.nist.gov"
 #define GMT_OFFSET_SEC         (3600 * 1)
 #define DAY_LIGHT_OFFSET_SEC   0
 
-// Software Functions Configuration
-#define UPDATE_WAKEUP_TIMER_US 60 * 1000000
+// Battery
+#define BATTERY_DIVIDER        2     // The ADC pin sees half of the battery voltage
+#define BATTERY_CAPACITY_MAH   250
+// Rough current draw of the watch, used to estimate the time left on the battery. Measure your own to refine it
+#define BATTERY_AWAKE_UA       45000
+#define BATTERY_SLEEP_UA       150
 
+// Software Functions Configuration
 #define ENABLE_MOTOR           1
 
+// Time the stages of every wake into RTC memory, send 'p' over serial while awake to print the statistics
+#define ENABLE_PROFILING       1
+// Run every wake at the next CPU frequency instead of the policy in lib/governor.cpp, send 'g' over serial while
+// awake to compare the time and the estimated charge of every phase per frequency
+#define ENABLE_GOVERNOR_SWEEP  0
+
 // Allow the setting of your WiFi credentials
 // If these values are not set the WiFi will be disabled giving longer battery life
 #define WIFI_SSID              ""
@@ -0,0 +1,103 @@
+#pragma once
+
+// Generated by tools/gen_font_metrics.py from Outfit_60011pt7b.h, do not edit
+
+constexpr GlyphMetrics Outfit_60011pt7bGlyphMetrics[] = {
+    {1, 4, 0},       // 0x20 ' '
+    {4, 6, 1},       // 0x21 '!'
+    {7, 10, 1},      // 0x22 '"'
+    {12, 14, 1},     // 0x23 '#'
+    {11, 13, 1},     // 0x24 '$'
+    {13, 14, 1},     // 0x25 '%'
+    {14, 15, 1},     // 0x26 '&'
+    {3, 5, 1},       // 0x27 "'"
+    {5, 7, 1},       // 0x28 '('
+    {6, 7, 0},       // 0x29 ')'
+    {9, 11, 1},      // 0x2A '*'
+    {10, 12, 1},     // 0x2B '+'
+    {4, 6, 1},       // 0x2C ','
+    {8, 10, 1},      // 0x2D '-'
+    {4, 6, 1},       // 0x2E '.'
+    {8, 8, 0},       // 0x2F '/'
+    {12, 14, 1},     // 0x30 '0'
+    {6, 8, 0},       // 0x31 '1'
+    {10, 12, 1},     // 0x32 '2'
+    {11, 12, 0},     // 0x33 '3'
+    {11, 13, 1},     // 0x34 '4'
+    {11, 12, 0},     // 0x35 '5'
+    {11, 12, 1},     // 0x36 '6'
+    {11, 11, 0},     // 0x37 '7'
+    {10, 12, 1},     // 0x38 '8'
+    {11, 12, 1},     // 0x39 '9'
+    {4, 6, 1},       // 0x3A ':'
+    {4, 6, 1},       // 0x3B ';'
+    {10, 12, 1},     // 0x3C '<'
+    {10, 12, 1},     // 0x3D '='
+    {10, 12, 1},     // 0x3E '>'
+    {9, 11, 1},      // 0x3F '?'
+    {14, 16, 1},     // 0x40 '@'
+    {15, 15, 0},     // 0x41 'A'
+    {11, 14, 2},     // 0x42 'B'
+    {13, 15, 1},     // 0x43 'C'
+    {13, 16, 2},     // 0x44 'D'
+    {10, 13, 2},     // 0x45 'E'
+    {10, 12, 2},     // 0x46 'F'
+    {15, 17, 1},     // 0x47 'G'
+    {12, 16, 2},     // 0x48 'H'
+    {2, 6, 2},       // 0x49 'I'
+    {10, 11, 0},     // 0x4A 'J'
+    {12, 15, 2},     // 0x4B 'K'
+    {9, 12, 2},      // 0x4C 'L'
+    {15, 18, 2},     // 0x4D 'M'
+    {12, 16, 2},     // 0x4E 'N'
+    {15, 17, 1},     // 0x4F 'O'
+    {11, 13, 2},     // 0x50 'P'
+    {16, 18, 1},     // 0x51 'Q'
+    {11, 14, 2},     // 0x52 'R'
+    {12, 12, 0},     // 0x53 'S'
+    {13, 14, 0},     // 0x54 'T'
+    {13, 15, 1},     // 0x55 'U'
+    {15, 15, 0},     // 0x56 'V'
+    {21, 21, 0},     // 0x57 'W'
+    {15, 15, 0},     // 0x58 'X'
+    {14, 15, 0},     // 0x59 'Y'
+    {11, 13, 1},     // 0x5A 'Z'
+    {6, 7, 1},       // 0x5B '['
+    {8, 8, 0},       // 0x5C '\\'
+    {5, 7, 1},       // 0x5D ']'
+    {8, 10, 1},      // 0x5E '^'
+    {11, 11, 0},     // 0x5F '_'
+    {5, 7, 1},       // 0x60 '`'
+    {10, 13, 1},     // 0x61 'a'
+    {11, 13, 1},     // 0x62 'b'
+    {9, 11, 1},      // 0x63 'c'
+    {10, 13, 1},     // 0x64 'd'
+    {10, 12, 1},     // 0x65 'e'
+    {10, 9, 0},      // 0x66 'f'
+    {10, 12, 1},     // 0x67 'g'
+    {10, 12, 1},     // 0x68 'h'
+    {3, 5, 1},       // 0x69 'i'
+    {8, 6, -3},      // 0x6A 'j'
+    {10, 11, 1},     // 0x6B 'k'
+    {3, 5, 1},       // 0x6C 'l'
+    {17, 19, 1},     // 0x6D 'm'
+    {10, 12, 1},     // 0x6E 'n'
+    {11, 12, 1},     // 0x6F 'o'
+    {11, 13, 1},     // 0x70 'p'
+    {10, 13, 1},     // 0x71 'q'
+    {8, 9, 1},       // 0x72 'r'
+    {9, 10, 0},      // 0x73 's'
+    {8, 8, 0},       // 0x74 't'
+    {9, 11, 1},      // 0x75 'u'
+    {11, 11, 0},     // 0x76 'v'
+    {16, 17, 0},     // 0x77 'w'
+    {11, 11, 0},     // 0x78 'x'
+    {11, 11, 0},     // 0x79 'y'
+    {8, 10, 1},      // 0x7A 'z'
+    {7, 7, 0},       // 0x7B '{'
+    {2, 6, 2},       // 0x7C '|'
+    {6, 7, 1},       // 0x7D '}'
+    {10, 12, 1}};    // 0x7E '~'
+
+constexpr FontMetrics Outfit_60011pt7bMetrics = {Outfit_60011pt7bGlyphMetrics, 0x20, 0x7E};
+
@@ -0,0 +1,248 @@
+#pragma once
+
+// Generated by tools/gen_digit_sprites.py from Outfit_80036pt7b.h, do not edit
+// Clock glyphs '0'-'9' and ':' rotated into the panel orientation, 7 bytes per glyph column
+
+const uint8_t Outfit_80036pt7bDigitBitmaps[] PROGMEM = {
+    0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFE, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xC0, 0x00, 0x3F,
+    0xFF, 0xC0, 0x7F, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x7F, 0xFC, 0x00,
+    0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x7F,
+    0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF,
+    0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xF0,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00,
+    0xFF, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x01, 0xFF, 0xE0, 0x7F, 0xFC, 0x00,
+    0x00, 0x03, 0xFF, 0xE0, 0x7F, 0xFE, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x3F,
+    0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xC0, 0x3F, 0xFF, 0xFC, 0x03, 0xFF, 0xFF,
+    0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+    0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x70,
+    0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x7F, 0xE0, 0x00, 0x00,
+    0x01, 0xFC, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x03, 0xFE, 0x00, 0x7F, 0xF8,
+    0x00, 0x00, 0x07, 0xFF, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0x00,
+    0x7F, 0xFE, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
+    0xFF, 0xC0, 0x7F, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0,
+    0x00, 0x07, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xE0, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
+    0xE0, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xFF, 0xFE, 0x00,
+    0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xF0, 0x7F, 0xFF,
+    0xFF, 0x80, 0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xF0,
+    0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00,
+    0x7F, 0xF0, 0x7F, 0xF7, 0xFF, 0xF8, 0x00, 0xFF, 0xF0, 0x7F, 0xF3, 0xFF,
+    0xFE, 0x01, 0xFF, 0xE0, 0x7F, 0xF1, 0xFF, 0xFF, 0x03, 0xFF, 0xE0, 0x7F,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x7F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xF0,
+    0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0x00,
+    0x7F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xFF,
+    0xFE, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x7F, 0xF0, 0x00,
+    0x1F, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x03, 0xFF, 0xC0, 0x00, 0x7F,
+    0xF0, 0x00, 0x00, 0x10, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0,
+    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x1F, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+    0x1F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0x00, 0x00,
+    0xFF, 0xE0, 0x3F, 0xFE, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x3F, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F,
+    0xF8, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0xFE, 0x00, 0xFF,
+    0xE0, 0x7F, 0xF0, 0x00, 0xFF, 0x80, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0xFF,
+    0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0xFF, 0xE0, 0xFF, 0xE0, 0xFF, 0xE0,
+    0x00, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0xFF, 0xE0,
+    0xFF, 0xE0, 0x00, 0xFF, 0xFC, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+    0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xF0, 0x00,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F,
+    0xF8, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFC, 0x03, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x7F, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF,
+    0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xE0,
+    0x1F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFC, 0x03,
+    0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xFF,
+    0xF8, 0x00, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xE0, 0x00,
+    0xFF, 0xFF, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x1F,
+    0xE0, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x1F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x00, 0x1F, 0xFC, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x1F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFC,
+    0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x00,
+    0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x07, 0xFF,
+    0xE0, 0x00, 0x1F, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE,
+    0x00, 0x7F, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xE0, 0x7F, 0xFF,
+    0xFF, 0xFE, 0x00, 0x07, 0xE0, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xE0,
+    0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x60, 0x7F, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F,
+    0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1F,
+    0xF0, 0x00, 0x3F, 0xFF, 0x00, 0x00, 0x1F, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
+    0x80, 0x3F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFE, 0x01, 0xFF,
+    0xFF, 0xFF, 0xE0, 0x3F, 0xFC, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF8,
+    0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x7F, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0x7F, 0xFF,
+    0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xE0, 0x00,
+    0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xC3, 0xFF, 0xE0, 0xFF,
+    0xE0, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0xFF,
+    0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xC0, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x7F,
+    0xC0, 0xFF, 0xE0, 0xFF, 0xF0, 0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xF0,
+    0x00, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xF8, 0x01, 0xFF, 0xC0, 0xFF, 0xE0,
+    0x7F, 0xFC, 0x03, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xFF, 0x0F, 0xFF, 0xC0,
+    0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF,
+    0xFF, 0x80, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xE0, 0x1F,
+    0xFF, 0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+    0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFC,
+    0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x01, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x03, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFC, 0x03,
+    0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
+    0xF0, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFE,
+    0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0x80, 0xFF, 0xE0, 0x00, 0x7F,
+    0xFF, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xE0,
+    0x00, 0x7F, 0xFF, 0xFF, 0xE0, 0xFF, 0xE0, 0x00, 0x7F, 0xDF, 0xFF, 0xE0,
+    0xFF, 0xF0, 0x00, 0x7F, 0xCF, 0xFF, 0xE0, 0x7F, 0xF0, 0x00, 0xFF, 0xC3,
+    0xFF, 0xE0, 0x7F, 0xF8, 0x01, 0xFF, 0xC1, 0xFF, 0xE0, 0x7F, 0xFE, 0x03,
+    0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x07,
+    0xE0, 0x1F, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xE0, 0x1F, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0xE0, 0x0F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x60, 0x07, 0xFF,
+    0xFF, 0xFC, 0x00, 0x00, 0x20, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+    0x01, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xE0, 0x60, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0,
+    0x7C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00,
+    0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xFC, 0x00,
+    0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
+    0xE0, 0x7F, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xE0,
+    0x00, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xE0, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x00, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xE0,
+    0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+    0xE0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
+    0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x3F, 0xF0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xF8,
+    0x00, 0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xE7,
+    0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
+    0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFC, 0x0F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x07, 0xFF, 0xE1, 0xFF, 0xE0, 0x7F,
+    0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xE0, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x7F,
+    0xF0, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x01, 0xFF,
+    0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0x01, 0xFF, 0x00, 0x3F, 0xF0, 0xFF, 0xE0,
+    0x01, 0xFF, 0x00, 0x7F, 0xF0, 0xFF, 0xE0, 0x03, 0xFF, 0x00, 0x7F, 0xF0,
+    0x7F, 0xF0, 0x03, 0xFF, 0x80, 0xFF, 0xF0, 0x7F, 0xF0, 0x07, 0xFF, 0xC1,
+    0xFF, 0xE0, 0x7F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x1F, 0xFF, 0xFF, 0xEF,
+    0xFF, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xE7, 0xFF, 0xFE, 0x00, 0x0F, 0xFF,
+    0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFF, 0x81, 0xFF, 0xF8, 0x00,
+    0x01, 0xFF, 0xFF, 0x00, 0x7F, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF0,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF,
+    0xFF, 0xFC, 0x00, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0xFE, 0x00, 0x70, 0x00,
+    0x07, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80,
+    0x7C, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80, 0x7F, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x7F, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xC0, 0x3F,
+    0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xF0, 0x3F, 0xFC, 0x03, 0xFF, 0xE0, 0x7F,
+    0xF8, 0x3F, 0xF8, 0x01, 0xFF, 0xE0, 0x7F, 0xFE, 0x3F, 0xF0, 0x00, 0xFF,
+    0xE0, 0x7F, 0xFF, 0x3F, 0xE0, 0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0,
+    0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x7F, 0xFF,
+    0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x3F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xF0,
+    0x1F, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
+    0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xE0, 0x00, 0xFF, 0xFF,
+    0xF8, 0x01, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+    0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFE, 0x00,
+    0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x0F,
+    0xE0, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0x01, 0xFF, 0x80, 0x00,
+    0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x07, 0xFF,
+    0xC0, 0x00, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC,
+    0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x00,
+    0xFF, 0xFC, 0x07, 0xFF, 0xE0, 0x00, 0x00, 0xFF, 0xFC, 0x07, 0xFF, 0xE0,
+    0x00, 0x00, 0x7F, 0xFC, 0x07, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xF8, 0x03,
+    0xFF, 0xC0, 0x00, 0x00, 0x3F, 0xF8, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x1F,
+    0xE0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x18, 0x00, 0x00,
+    0x00};
+
+const DigitSprite Outfit_80036pt7bDigitSprites[] PROGMEM = {
+    {0, 43, 47, 2},        // '0'
+    {301, 22, 28, 1},      // '1'
+    {455, 38, 41, 1},      // '2'
+    {721, 37, 40, 1},      // '3'
+    {980, 41, 43, 1},      // '4'
+    {1267, 37, 40, 1},     // '5'
+    {1526, 38, 41, 1},     // '6'
+    {1792, 35, 37, 1},     // '7'
+    {2037, 36, 40, 2},     // '8'
+    {2289, 38, 41, 1},     // '9'
+    {2555, 14, 21, 4}};    // ':'
+
+const DigitSpriteFont Outfit_80036pt7bDigits PROGMEM = {
+    (uint8_t *)Outfit_80036pt7bDigitBitmaps,
+    (DigitSprite *)Outfit_80036pt7bDigitSprites,
+    7, 1};
+
+// Approx. 2718 bytes
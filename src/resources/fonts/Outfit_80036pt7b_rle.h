@@ -0,0 +1,438 @@
+#pragma once
+
+// Generated by tools/compress_font.py from Outfit_80036pt7b.h, do not edit
+// Run length encoded glyphs, 7955 bytes instead of 18804 bytes of bitmaps
+
+const uint8_t Outfit_80036pt7bRuns[] PROGMEM = {
+    0x01, 0x2B, 0x03, 0x06, 0x0B, 0x1E, 0x08, 0x03, 0x1B, 0x0C, 0x0B, 0x02, 0x20, 0x07, 0x0C, 0x01, 0x20, 0x06, 0x0D, 0x01, 0x20, 0x06, 0x2E, 0x06,
+    0x2E, 0x06, 0x2E, 0x06, 0x2E, 0x06, 0x0D, 0x01, 0x20, 0x06, 0x0D, 0x01, 0x20, 0x07, 0x0C, 0x01, 0x19, 0x0F, 0x0A, 0x02, 0x09, 0x20, 0x07, 0x04,
+    0x00, 0x01, 0x15, 0x0B, 0x0B, 0xBD, 0x09, 0x03, 0x55, 0x01, 0x15, 0x0B, 0x0B, 0xBD, 0x09, 0x03, 0x13, 0x1C, 0x08, 0x2A, 0x08, 0x2A, 0x08, 0x1B,
+    0x08, 0x07, 0x08, 0x1B, 0x08, 0x07, 0x08, 0x0C, 0x02, 0x0D, 0x08, 0x07, 0x08, 0x06, 0x08, 0x0D, 0x08, 0x07, 0x16, 0x0D, 0x08, 0x07, 0x16, 0x0D,
+    0x08, 0x04, 0x19, 0x0D, 0x25, 0x0D, 0x25, 0x07, 0x2B, 0x01, 0x93, 0x02, 0x2A, 0x08, 0x24, 0x0E, 0x24, 0x0E, 0x18, 0x04, 0x08, 0x0E, 0x15, 0x07,
+    0x08, 0x0E, 0x0C, 0x01, 0x08, 0x07, 0x08, 0x0D, 0x07, 0x07, 0x08, 0x07, 0x08, 0x08, 0x07, 0x0C, 0x08, 0x07, 0x08, 0x02, 0x0C, 0x0D, 0x08, 0x07,
+    0x16, 0x0D, 0x08, 0x05, 0x18, 0x0D, 0x25, 0x0D, 0x25, 0x08, 0x2A, 0x03, 0x92, 0x01, 0x2B, 0x07, 0x25, 0x0D, 0x24, 0x0E, 0x19, 0x03, 0x08, 0x0E,
+    0x15, 0x07, 0x08, 0x0E, 0x15, 0x07, 0x08, 0x0E, 0x08, 0x05, 0x08, 0x07, 0x08, 0x0E, 0x02, 0x0B, 0x08, 0x07, 0x08, 0x1B, 0x08, 0x07, 0x08, 0x1B,
+    0x08, 0x07, 0x08, 0x1B, 0x08, 0x2A, 0x08, 0x1D, 0x31, 0x01, 0x3E, 0x03, 0x3C, 0x05, 0x1E, 0x06, 0x16, 0x07, 0x1A, 0x0D, 0x11, 0x09, 0x17, 0x10,
+    0x0F, 0x0A, 0x16, 0x13, 0x0C, 0x0C, 0x14, 0x15, 0x0A, 0x0E, 0x12, 0x17, 0x0A, 0x0D, 0x11, 0x18, 0x0B, 0x0C, 0x11, 0x19, 0x0A, 0x0D, 0x0F, 0x1A,
+    0x0B, 0x0C, 0x0F, 0x1B, 0x0B, 0x0B, 0x0E, 0x1C, 0x0B, 0x0B, 0x0E, 0x1D, 0x0B, 0x0A, 0x0E, 0x0C, 0x02, 0x0F, 0x0B, 0x0B, 0x06, 0xFF, 0x00, 0xFF,
+    0x00, 0x42, 0x07, 0x0B, 0x09, 0x0E, 0x04, 0x0C, 0x0E, 0x0B, 0x09, 0x1E, 0x0E, 0x0C, 0x09, 0x1D, 0x0E, 0x0D, 0x08, 0x1C, 0x10, 0x0C, 0x08, 0x1C,
+    0x10, 0x0D, 0x08, 0x1A, 0x11, 0x0C, 0x0A, 0x19, 0x12, 0x0A, 0x0B, 0x18, 0x13, 0x09, 0x0D, 0x16, 0x15, 0x07, 0x0F, 0x14, 0x17, 0x05, 0x11, 0x12,
+    0x19, 0x03, 0x14, 0x0E, 0x1C, 0x01, 0x17, 0x0A, 0x11, 0x08, 0x06, 0x2C, 0x0A, 0x28, 0x0E, 0x25, 0x10, 0x1F, 0x01, 0x03, 0x12, 0x1C, 0x03, 0x03,
+    0x12, 0x1A, 0x05, 0x02, 0x14, 0x17, 0x07, 0x02, 0x14, 0x16, 0x08, 0x02, 0x09, 0x02, 0x09, 0x14, 0x0A, 0x01, 0x09, 0x04, 0x08, 0x12, 0x0C, 0x01,
+    0x08, 0x05, 0x08, 0x11, 0x0D, 0x01, 0x08, 0x05, 0x08, 0x0F, 0x0F, 0x02, 0x08, 0x04, 0x08, 0x0D, 0x11, 0x02, 0x14, 0x0B, 0x13, 0x02, 0x14, 0x0A,
+    0x12, 0x04, 0x13, 0x09, 0x13, 0x06, 0x12, 0x07, 0x13, 0x09, 0x10, 0x06, 0x13, 0x0C, 0x0E, 0x06, 0x13, 0x0E, 0x0C, 0x05, 0x13, 0x11, 0x09, 0x05,
+    0x13, 0x20, 0x12, 0x20, 0x13, 0x1F, 0x13, 0x1F, 0x13, 0x05, 0x08, 0x13, 0x12, 0x05, 0x0C, 0x0F, 0x13, 0x05, 0x0E, 0x0C, 0x13, 0x06, 0x10, 0x09,
+    0x13, 0x07, 0x12, 0x07, 0x12, 0x09, 0x13, 0x04, 0x13, 0x09, 0x14, 0x02, 0x13, 0x0B, 0x14, 0x02, 0x11, 0x0D, 0x08, 0x04, 0x08, 0x02, 0x10, 0x0E,
+    0x08, 0x04, 0x09, 0x01, 0x0E, 0x10, 0x08, 0x05, 0x08, 0x01, 0x0C, 0x12, 0x08, 0x04, 0x09, 0x01, 0x0A, 0x14, 0x09, 0x03, 0x08, 0x02, 0x09, 0x15,
+    0x14, 0x02, 0x07, 0x17, 0x14, 0x02, 0x05, 0x1A, 0x12, 0x03, 0x03, 0x1C, 0x12, 0x03, 0x02, 0x1E, 0x10, 0x25, 0x0E, 0x27, 0x0C, 0x2A, 0x08, 0x07,
+    0x22, 0x04, 0x2C, 0x0C, 0x26, 0x10, 0x23, 0x13, 0x20, 0x15, 0x1E, 0x17, 0x0E, 0x0A, 0x04, 0x19, 0x0B, 0x0E, 0x01, 0x1A, 0x09, 0x2C, 0x07, 0x2D,
+    0x06, 0x2F, 0x04, 0x30, 0x04, 0x1E, 0x05, 0x0D, 0x03, 0x1D, 0x08, 0x0D, 0x01, 0x1E, 0x09, 0x0C, 0x01, 0x1F, 0x08, 0x0C, 0x01, 0x20, 0x08, 0x0B,
+    0x01, 0x0D, 0x03, 0x11, 0x07, 0x17, 0x06, 0x11, 0x06, 0x17, 0x08, 0x10, 0x04, 0x18, 0x09, 0x10, 0x03, 0x17, 0x0B, 0x10, 0x01, 0x0C, 0x01, 0x0C,
+    0x0B, 0x1C, 0x01, 0x0C, 0x0C, 0x1B, 0x01, 0x0C, 0x0D, 0x19, 0x03, 0x0C, 0x0D, 0x18, 0x03, 0x0D, 0x0D, 0x17, 0x03, 0x0E, 0x0E, 0x14, 0x05, 0x0C,
+    0x10, 0x12, 0x06, 0x0B, 0x12, 0x11, 0x07, 0x09, 0x14, 0x10, 0x07, 0x08, 0x16, 0x10, 0x07, 0x06, 0x18, 0x10, 0x07, 0x04, 0x1A, 0x10, 0x07, 0x02,
+    0x1C, 0x0F, 0x27, 0x0D, 0x28, 0x0C, 0x29, 0x0B, 0x2A, 0x0A, 0x2B, 0x09, 0x2C, 0x08, 0x2D, 0x07, 0x2E, 0x06, 0x30, 0x04, 0x31, 0x03, 0x32, 0x02,
+    0x33, 0x01, 0x01, 0x00, 0x02, 0x14, 0x0D, 0x09, 0xBC, 0x0A, 0x01, 0x15, 0x18, 0x10, 0x2A, 0x19, 0x23, 0x20, 0x1C, 0x25, 0x18, 0x29, 0x14, 0x2D,
+    0x11, 0x30, 0x0D, 0x33, 0x0B, 0x36, 0x08, 0x38, 0x06, 0x1A, 0x06, 0x1A, 0x04, 0x14, 0x14, 0x14, 0x01, 0x12, 0x1C, 0x11, 0x01, 0x0F, 0x20, 0x0F,
+    0x02, 0x0C, 0x24, 0x0C, 0x04, 0x09, 0x28, 0x09, 0x06, 0x07, 0x2A, 0x07, 0x08, 0x04, 0x2E, 0x04, 0x0A, 0x02, 0x30, 0x02, 0x05, 0x06, 0x02, 0x30,
+    0x01, 0x0B, 0x04, 0x2E, 0x03, 0x09, 0x06, 0x2C, 0x05, 0x07, 0x09, 0x28, 0x08, 0x05, 0x0B, 0x25, 0x0B, 0x03, 0x0E, 0x21, 0x0E, 0x01, 0x12, 0x1C,
+    0x11, 0x01, 0x14, 0x16, 0x13, 0x03, 0x19, 0x0A, 0x18, 0x06, 0x38, 0x08, 0x36, 0x0A, 0x34, 0x0C, 0x31, 0x10, 0x2E, 0x13, 0x2A, 0x17, 0x26, 0x1C,
+    0x20, 0x22, 0x1A, 0x29, 0x12, 0x16, 0x11, 0x02, 0x1D, 0x04, 0x11, 0x02, 0x08, 0x06, 0x0E, 0x04, 0x06, 0x09, 0x0B, 0x06, 0x05, 0x0A, 0x09, 0x07,
+    0x05, 0x09, 0x09, 0x09, 0x04, 0x08, 0x09, 0x0B, 0x02, 0x09, 0x09, 0x0B, 0x02, 0x08, 0x0B, 0x0B, 0x01, 0x07, 0x0E, 0x10, 0x10, 0x0F, 0x12, 0x0C,
+    0x14, 0x16, 0x09, 0x15, 0x07, 0x18, 0x03, 0x1C, 0x01, 0x1E, 0x01, 0x1E, 0x02, 0x12, 0x03, 0x08, 0x03, 0x0A, 0x01, 0x06, 0x06, 0x04, 0x04, 0x08,
+    0x03, 0x07, 0x08, 0x01, 0x05, 0x06, 0x04, 0x07, 0x0E, 0x04, 0x06, 0x08, 0x0E, 0x02, 0x07, 0x08, 0x0E, 0x01, 0x08, 0x08, 0x17, 0x09, 0x16, 0x09,
+    0x16, 0x09, 0x16, 0x04, 0x0E, 0x0C, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19,
+    0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x0D, 0xFF, 0x00, 0x5F, 0x0C, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19,
+    0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0x0D, 0x05, 0x04, 0x13, 0x08, 0x09, 0x02, 0x04, 0x0B, 0x06, 0x05, 0x03, 0x0C, 0x03, 0x07,
+    0x02, 0x0D, 0x01, 0x0A, 0x01, 0x18, 0x01, 0x2F, 0x03, 0x15, 0x04, 0x13, 0x06, 0x11, 0x09, 0x0E, 0x0C, 0x0B, 0x0F, 0x08, 0x0E, 0x00, 0xFA, 0x03,
+    0x07, 0x06, 0x0A, 0x03, 0x0B, 0x02, 0x0D, 0x01, 0x0D, 0x01, 0x45, 0x02, 0x0C, 0x02, 0x0B, 0x04, 0x09, 0x08, 0x04, 0x05, 0x38, 0x02, 0x35, 0x05,
+    0x31, 0x09, 0x2E, 0x0C, 0x2A, 0x10, 0x26, 0x14, 0x23, 0x17, 0x1F, 0x1B, 0x1C, 0x1E, 0x18, 0x22, 0x14, 0x26, 0x11, 0x26, 0x10, 0x26, 0x10, 0x26,
+    0x11, 0x26, 0x10, 0x26, 0x12, 0x25, 0x15, 0x21, 0x19, 0x1D, 0x1D, 0x1A, 0x20, 0x16, 0x24, 0x12, 0x28, 0x0F, 0x2B, 0x0B, 0x2F, 0x08, 0x32, 0x04,
+    0x36, 0x01, 0x39, 0x13, 0x0E, 0x22, 0x15, 0x1D, 0x1A, 0x18, 0x1E, 0x14, 0x21, 0x12, 0x24, 0x0F, 0x26, 0x0D, 0x28, 0x0B, 0x2A, 0x09, 0x2C, 0x07,
+    0x2D, 0x07, 0x2E, 0x05, 0x30, 0x04, 0x10, 0x10, 0x10, 0x03, 0x0F, 0x14, 0x0F, 0x02, 0x0D, 0x18, 0x0D, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0B, 0x1C,
+    0x0B, 0x01, 0x0C, 0x1C, 0x17, 0x1E, 0x16, 0x1E, 0x16, 0x1E, 0x16, 0x1E, 0x16, 0x1E, 0x17, 0x1C, 0x0C, 0x01, 0x0B, 0x1C, 0x0B, 0x02, 0x0C, 0x1A,
+    0x0C, 0x02, 0x0D, 0x18, 0x0D, 0x02, 0x0E, 0x16, 0x0E, 0x03, 0x0F, 0x12, 0x0F, 0x04, 0x14, 0x08, 0x14, 0x05, 0x2E, 0x06, 0x2E, 0x07, 0x2C, 0x09,
+    0x2A, 0x0B, 0x29, 0x0C, 0x26, 0x0F, 0x24, 0x11, 0x22, 0x14, 0x1E, 0x17, 0x1C, 0x1B, 0x16, 0x21, 0x10, 0x12, 0x00, 0x0B, 0x27, 0x0B, 0x27, 0x0B,
+    0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0xFF, 0x00, 0xFF, 0x00, 0x5A, 0x0A, 0x01, 0x30, 0x03,
+    0x20, 0x08, 0x07, 0x05, 0x1E, 0x09, 0x06, 0x07, 0x1C, 0x0A, 0x05, 0x09, 0x1A, 0x0B, 0x04, 0x0B, 0x18, 0x0C, 0x04, 0x0C, 0x16, 0x0D, 0x03, 0x0E,
+    0x14, 0x0E, 0x02, 0x10, 0x12, 0x0F, 0x02, 0x0E, 0x13, 0x10, 0x02, 0x0D, 0x13, 0x11, 0x01, 0x0D, 0x13, 0x12, 0x01, 0x0C, 0x13, 0x13, 0x01, 0x0B,
+    0x13, 0x14, 0x01, 0x0B, 0x12, 0x20, 0x12, 0x21, 0x11, 0x22, 0x10, 0x23, 0x0F, 0x24, 0x0E, 0x25, 0x0D, 0x27, 0x0B, 0x10, 0x01, 0x0B, 0x01, 0x0C,
+    0x08, 0x11, 0x02, 0x0B, 0x01, 0x0D, 0x06, 0x11, 0x03, 0x0B, 0x01, 0x23, 0x04, 0x0B, 0x01, 0x22, 0x05, 0x0B, 0x01, 0x21, 0x06, 0x0B, 0x02, 0x1F,
+    0x07, 0x0B, 0x02, 0x1E, 0x08, 0x0B, 0x03, 0x1C, 0x09, 0x0B, 0x04, 0x1A, 0x0A, 0x0B, 0x04, 0x19, 0x0B, 0x0B, 0x05, 0x17, 0x0C, 0x0B, 0x07, 0x13,
+    0x0E, 0x0B, 0x08, 0x11, 0x0F, 0x0B, 0x0A, 0x0C, 0x12, 0x0B, 0x10, 0x01, 0x17, 0x0B, 0x28, 0x0B, 0x2B, 0x02, 0x30, 0x04, 0x2E, 0x05, 0x05, 0x0B,
+    0x1D, 0x07, 0x04, 0x0B, 0x1C, 0x09, 0x03, 0x0B, 0x1B, 0x0A, 0x03, 0x0B, 0x1A, 0x0C, 0x02, 0x0B, 0x19, 0x0D, 0x02, 0x0B, 0x1A, 0x0C, 0x02, 0x0B,
+    0x1B, 0x0C, 0x01, 0x0B, 0x1B, 0x0C, 0x01, 0x0B, 0x09, 0x07, 0x0C, 0x0B, 0x01, 0x0B, 0x07, 0x09, 0x0C, 0x0B, 0x01, 0x0B, 0x06, 0x0A, 0x0D, 0x0A,
+    0x01, 0x0B, 0x05, 0x0B, 0x0D, 0x16, 0x04, 0x0C, 0x0D, 0x16, 0x03, 0x0D, 0x0D, 0x16, 0x02, 0x0E, 0x0D, 0x26, 0x0D, 0x26, 0x0D, 0x26, 0x0C, 0x28,
+    0x0B, 0x0B, 0x01, 0x1C, 0x0A, 0x0C, 0x01, 0x1D, 0x08, 0x0D, 0x01, 0x1F, 0x04, 0x0F, 0x01, 0x31, 0x02, 0x12, 0x01, 0x1E, 0x02, 0x11, 0x03, 0x1D,
+    0x02, 0x0F, 0x05, 0x1C, 0x03, 0x0E, 0x06, 0x1C, 0x03, 0x0D, 0x08, 0x1A, 0x04, 0x0C, 0x0A, 0x18, 0x05, 0x0B, 0x0B, 0x17, 0x06, 0x0A, 0x0D, 0x15,
+    0x07, 0x09, 0x10, 0x12, 0x08, 0x08, 0x12, 0x0F, 0x27, 0x0A, 0x0C, 0x20, 0x08, 0x28, 0x0A, 0x26, 0x0C, 0x24, 0x0E, 0x22, 0x10, 0x20, 0x12, 0x1E,
+    0x14, 0x1C, 0x16, 0x1A, 0x18, 0x17, 0x1B, 0x15, 0x1D, 0x13, 0x1F, 0x11, 0x21, 0x0F, 0x23, 0x0D, 0x25, 0x0B, 0x27, 0x0A, 0x1B, 0x02, 0x0B, 0x0A,
+    0x18, 0x05, 0x0B, 0x0A, 0x16, 0x07, 0x0B, 0x0A, 0x14, 0x09, 0x0B, 0x0A, 0x12, 0x0B, 0x0B, 0x0A, 0x10, 0x0D, 0x0B, 0x0A, 0x0E, 0x0F, 0x0B, 0x0A,
+    0x0C, 0x11, 0x0B, 0x0A, 0x0A, 0x0A, 0x26, 0x0C, 0x24, 0x0E, 0x22, 0x10, 0x20, 0x12, 0x1E, 0x14, 0x1E, 0x14, 0x1E, 0x14, 0x1E, 0x14, 0x1E, 0x14,
+    0x1E, 0x14, 0x1E, 0x14, 0x1E, 0x1D, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x0A, 0x2B, 0x02, 0x30, 0x04, 0x2E, 0x05, 0x1A, 0x03,
+    0x10, 0x07, 0x0F, 0x0E, 0x0E, 0x09, 0x05, 0x18, 0x0C, 0x0A, 0x03, 0x1B, 0x0A, 0x0C, 0x02, 0x1C, 0x08, 0x0D, 0x02, 0x1C, 0x09, 0x0C, 0x02, 0x1B,
+    0x0B, 0x0C, 0x01, 0x1B, 0x0C, 0x0B, 0x01, 0x1B, 0x0C, 0x0B, 0x01, 0x1A, 0x0D, 0x0B, 0x01, 0x1A, 0x0E, 0x0A, 0x01, 0x1A, 0x0E, 0x18, 0x04, 0x09,
+    0x0E, 0x16, 0x06, 0x09, 0x0E, 0x16, 0x06, 0x09, 0x0E, 0x16, 0x06, 0x09, 0x0E, 0x16, 0x06, 0x09, 0x0E, 0x16, 0x06, 0x0A, 0x0C, 0x17, 0x06, 0x0A,
+    0x0C, 0x0B, 0x01, 0x0B, 0x06, 0x0B, 0x0A, 0x0C, 0x01, 0x0B, 0x06, 0x0C, 0x08, 0x0D, 0x01, 0x0B, 0x06, 0x0E, 0x04, 0x0F, 0x01, 0x0B, 0x07, 0x20,
+    0x01, 0x0B, 0x07, 0x1F, 0x02, 0x0B, 0x07, 0x1F, 0x02, 0x0B, 0x08, 0x1D, 0x03, 0x0B, 0x08, 0x1D, 0x03, 0x0B, 0x09, 0x1B, 0x04, 0x0B, 0x0A, 0x19,
+    0x05, 0x0B, 0x0B, 0x17, 0x06, 0x0B, 0x0C, 0x15, 0x1F, 0x13, 0x22, 0x0F, 0x27, 0x09, 0x0D, 0x20, 0x02, 0x2C, 0x0C, 0x25, 0x10, 0x21, 0x14, 0x1D,
+    0x17, 0x1B, 0x19, 0x18, 0x1C, 0x16, 0x1E, 0x13, 0x21, 0x11, 0x22, 0x0F, 0x25, 0x0D, 0x26, 0x0C, 0x28, 0x09, 0x15, 0x08, 0x0D, 0x08, 0x15, 0x0A,
+    0x0C, 0x06, 0x16, 0x0C, 0x0B, 0x05, 0x16, 0x0E, 0x0B, 0x02, 0x18, 0x0E, 0x0B, 0x01, 0x19, 0x0E, 0x25, 0x0E, 0x25, 0x0E, 0x1B, 0x01, 0x09, 0x0E,
+    0x1A, 0x02, 0x09, 0x0D, 0x19, 0x04, 0x0A, 0x0C, 0x0B, 0x01, 0x0C, 0x05, 0x0B, 0x0A, 0x0C, 0x01, 0x0B, 0x06, 0x0C, 0x07, 0x0E, 0x01, 0x09, 0x08,
+    0x21, 0x01, 0x08, 0x0A, 0x1F, 0x02, 0x06, 0x0C, 0x1F, 0x02, 0x05, 0x0E, 0x1D, 0x03, 0x04, 0x0F, 0x1D, 0x03, 0x02, 0x12, 0x1B, 0x04, 0x01, 0x14,
+    0x19, 0x1A, 0x18, 0x1D, 0x15, 0x1F, 0x13, 0x22, 0x0F, 0x26, 0x0B, 0x0C, 0x00, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B,
+    0x27, 0x0B, 0x27, 0x0B, 0x25, 0x0D, 0x22, 0x10, 0x1F, 0x13, 0x1D, 0x15, 0x1A, 0x18, 0x17, 0x1B, 0x15, 0x1D, 0x12, 0x20, 0x10, 0x22, 0x0D, 0x25,
+    0x0A, 0x28, 0x08, 0x2A, 0x05, 0x2D, 0x02, 0x22, 0x03, 0x2D, 0x05, 0x2A, 0x08, 0x27, 0x0B, 0x24, 0x0E, 0x22, 0x10, 0x1F, 0x13, 0x1C, 0x16, 0x19,
+    0x19, 0x17, 0x1B, 0x14, 0x1E, 0x11, 0x21, 0x0E, 0x24, 0x0C, 0x26, 0x09, 0x29, 0x20, 0x0A, 0x28, 0x0E, 0x11, 0x0A, 0x09, 0x11, 0x0E, 0x0E, 0x06,
+    0x14, 0x0B, 0x10, 0x04, 0x15, 0x0A, 0x12, 0x02, 0x17, 0x08, 0x14, 0x01, 0x18, 0x06, 0x2E, 0x05, 0x30, 0x04, 0x30, 0x04, 0x31, 0x02, 0x32, 0x02,
+    0x1F, 0x06, 0x0D, 0x02, 0x0C, 0x04, 0x0E, 0x09, 0x0B, 0x02, 0x0B, 0x07, 0x0B, 0x0A, 0x0B, 0x01, 0x0B, 0x09, 0x0A, 0x0B, 0x16, 0x09, 0x09, 0x0C,
+    0x15, 0x0A, 0x09, 0x0C, 0x15, 0x0A, 0x09, 0x0C, 0x16, 0x09, 0x09, 0x0C, 0x16, 0x09, 0x0A, 0x0B, 0x17, 0x07, 0x0B, 0x0A, 0x0B, 0x02, 0x0C, 0x05,
+    0x0D, 0x09, 0x0B, 0x02, 0x1F, 0x07, 0x0C, 0x02, 0x32, 0x02, 0x32, 0x03, 0x30, 0x04, 0x30, 0x05, 0x2F, 0x06, 0x14, 0x01, 0x18, 0x08, 0x12, 0x02,
+    0x17, 0x0A, 0x10, 0x04, 0x16, 0x0B, 0x0E, 0x06, 0x14, 0x0E, 0x0A, 0x09, 0x11, 0x25, 0x0E, 0x28, 0x0A, 0x0A, 0x10, 0x04, 0x2B, 0x0C, 0x24, 0x11,
+    0x21, 0x13, 0x1F, 0x16, 0x1C, 0x18, 0x1A, 0x1A, 0x13, 0x01, 0x04, 0x1B, 0x11, 0x03, 0x03, 0x1D, 0x0F, 0x04, 0x03, 0x1E, 0x0D, 0x05, 0x02, 0x1F,
+    0x0B, 0x07, 0x02, 0x1F, 0x0A, 0x08, 0x01, 0x21, 0x08, 0x09, 0x01, 0x0D, 0x08, 0x0C, 0x06, 0x0B, 0x01, 0x0C, 0x0A, 0x0B, 0x05, 0x0C, 0x01, 0x0B,
+    0x0C, 0x0A, 0x03, 0x19, 0x0E, 0x09, 0x02, 0x1A, 0x0E, 0x25, 0x0E, 0x25, 0x0E, 0x25, 0x0E, 0x19, 0x01, 0x0B, 0x0E, 0x18, 0x02, 0x0C, 0x0D, 0x16,
+    0x05, 0x0B, 0x0C, 0x16, 0x06, 0x0C, 0x0A, 0x15, 0x08, 0x0E, 0x07, 0x15, 0x09, 0x28, 0x0C, 0x26, 0x0D, 0x24, 0x10, 0x22, 0x11, 0x20, 0x14, 0x1E,
+    0x16, 0x1B, 0x19, 0x19, 0x1B, 0x16, 0x1E, 0x14, 0x21, 0x10, 0x25, 0x0B, 0x1C, 0x04, 0x07, 0x0D, 0x07, 0x06, 0x0A, 0x0B, 0x0A, 0x03, 0x0C, 0x09,
+    0x0C, 0x02, 0x0D, 0x07, 0x0D, 0x01, 0x0E, 0x07, 0x0D, 0x01, 0x0E, 0x07, 0x1C, 0x07, 0x1C, 0x07, 0x1C, 0x07, 0x0E, 0x01, 0x0D, 0x07, 0x0D, 0x02,
+    0x0C, 0x09, 0x0C, 0x03, 0x0A, 0x0A, 0x0B, 0x05, 0x08, 0x0D, 0x08, 0x09, 0x02, 0x13, 0x02, 0x06, 0x05, 0x05, 0x0F, 0x05, 0x0C, 0x01, 0x06, 0x09,
+    0x0C, 0x08, 0x08, 0x03, 0x05, 0x0B, 0x09, 0x0B, 0x06, 0x05, 0x03, 0x0C, 0x09, 0x0C, 0x03, 0x07, 0x03, 0x0D, 0x07, 0x0D, 0x01, 0x0A, 0x01, 0x0E,
+    0x07, 0x27, 0x07, 0x18, 0x01, 0x0E, 0x07, 0x16, 0x03, 0x0E, 0x07, 0x14, 0x05, 0x0E, 0x07, 0x12, 0x08, 0x0D, 0x07, 0x11, 0x0A, 0x0B, 0x09, 0x0E,
+    0x0C, 0x0A, 0x0B, 0x0B, 0x10, 0x06, 0x0E, 0x08, 0x0E, 0x0E, 0x09, 0x1B, 0x09, 0x1A, 0x0B, 0x19, 0x0B, 0x18, 0x0C, 0x18, 0x0D, 0x17, 0x0D, 0x16,
+    0x0F, 0x15, 0x0F, 0x14, 0x10, 0x14, 0x11, 0x13, 0x11, 0x12, 0x13, 0x11, 0x13, 0x10, 0x14, 0x10, 0x0A, 0x01, 0x0A, 0x0F, 0x0A, 0x01, 0x0A, 0x0E,
+    0x0A, 0x02, 0x0B, 0x0D, 0x0A, 0x03, 0x0A, 0x0C, 0x0B, 0x03, 0x0A, 0x0C, 0x0A, 0x04, 0x0B, 0x0A, 0x0B, 0x05, 0x0A, 0x0A, 0x0B, 0x05, 0x0B, 0x09,
+    0x0A, 0x07, 0x0A, 0x08, 0x0B, 0x07, 0x0B, 0x07, 0x0A, 0x08, 0x0B, 0x06, 0x0B, 0x09, 0x0A, 0x06, 0x0B, 0x09, 0x0B, 0x05, 0x0A, 0x0B, 0x0A, 0x04,
+    0x0B, 0x0B, 0x0B, 0x03, 0x0A, 0x0C, 0x0B, 0x02, 0x0B, 0x0D, 0x0A, 0x02, 0x0B, 0x0D, 0x16, 0x0E, 0x0B, 0x00, 0x0A, 0x07, 0x14, 0x07, 0x14, 0x07,
+    0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07,
+    0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07,
+    0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x14, 0x07, 0x0A, 0x00, 0x0B, 0x0E, 0x0B, 0x01, 0x0B, 0x0D, 0x0B, 0x02,
+    0x0A, 0x0D, 0x0A, 0x03, 0x0B, 0x0B, 0x0B, 0x03, 0x0B, 0x0B, 0x0A, 0x05, 0x0A, 0x0A, 0x0B, 0x05, 0x0B, 0x09, 0x0B, 0x06, 0x0A, 0x09, 0x0A, 0x07,
+    0x0B, 0x07, 0x0B, 0x07, 0x0B, 0x07, 0x0A, 0x09, 0x0A, 0x06, 0x0B, 0x09, 0x0B, 0x05, 0x0B, 0x0A, 0x0A, 0x05, 0x0A, 0x0B, 0x0B, 0x03, 0x0B, 0x0B,
+    0x0B, 0x03, 0x0A, 0x0D, 0x0A, 0x02, 0x0B, 0x0D, 0x0B, 0x01, 0x0A, 0x0F, 0x0A, 0x01, 0x0A, 0x0F, 0x15, 0x10, 0x13, 0x11, 0x13, 0x11, 0x12, 0x13,
+    0x11, 0x13, 0x11, 0x14, 0x0F, 0x15, 0x0F, 0x15, 0x0E, 0x17, 0x0D, 0x17, 0x0D, 0x18, 0x0B, 0x19, 0x0B, 0x19, 0x0A, 0x1B, 0x09, 0x0D, 0x08, 0x01,
+    0x33, 0x03, 0x31, 0x05, 0x2F, 0x07, 0x2D, 0x09, 0x2B, 0x0B, 0x29, 0x0D, 0x28, 0x0E, 0x26, 0x0E, 0x27, 0x0D, 0x28, 0x0C, 0x1E, 0x05, 0x05, 0x0D,
+    0x1C, 0x09, 0x03, 0x0C, 0x08, 0x0D, 0x07, 0x0B, 0x02, 0x0C, 0x08, 0x0D, 0x07, 0x0C, 0x01, 0x0B, 0x09, 0x0D, 0x06, 0x0D, 0x01, 0x0B, 0x09, 0x0D,
+    0x06, 0x19, 0x09, 0x0D, 0x06, 0x1A, 0x07, 0x0E, 0x06, 0x1A, 0x07, 0x0E, 0x06, 0x1B, 0x05, 0x0F, 0x06, 0x0D, 0x01, 0x21, 0x06, 0x0D, 0x02, 0x20,
+    0x07, 0x0B, 0x03, 0x1B, 0x0D, 0x09, 0x04, 0x1B, 0x0E, 0x07, 0x06, 0x19, 0x1C, 0x19, 0x1D, 0x17, 0x1F, 0x15, 0x21, 0x13, 0x23, 0x11, 0x26, 0x0D,
+    0x2B, 0x08, 0x22, 0x11, 0x0E, 0x20, 0x13, 0x1B, 0x17, 0x17, 0x1B, 0x14, 0x1D, 0x11, 0x20, 0x0F, 0x22, 0x0D, 0x24, 0x0B, 0x13, 0x01, 0x12, 0x0A,
+    0x0D, 0x0D, 0x0D, 0x08, 0x0C, 0x11, 0x0B, 0x07, 0x0B, 0x14, 0x0B, 0x06, 0x0A, 0x17, 0x0A, 0x04, 0x0A, 0x08, 0x09, 0x08, 0x09, 0x04, 0x09, 0x07,
+    0x0C, 0x07, 0x0A, 0x03, 0x08, 0x07, 0x0F, 0x06, 0x09, 0x02, 0x09, 0x06, 0x11, 0x06, 0x08, 0x02, 0x09, 0x05, 0x12, 0x06, 0x09, 0x01, 0x08, 0x05,
+    0x14, 0x05, 0x12, 0x05, 0x14, 0x06, 0x11, 0x05, 0x08, 0x04, 0x09, 0x05, 0x10, 0x05, 0x08, 0x06, 0x08, 0x05, 0x10, 0x05, 0x08, 0x07, 0x07, 0x05,
+    0x10, 0x05, 0x08, 0x07, 0x07, 0x05, 0x10, 0x05, 0x08, 0x07, 0x07, 0x05, 0x10, 0x05, 0x08, 0x06, 0x08, 0x05, 0x10, 0x06, 0x09, 0x03, 0x08, 0x06,
+    0x10, 0x06, 0x14, 0x06, 0x10, 0x06, 0x15, 0x05, 0x11, 0x05, 0x15, 0x05, 0x08, 0x01, 0x08, 0x05, 0x15, 0x04, 0x09, 0x01, 0x08, 0x05, 0x15, 0x04,
+    0x08, 0x02, 0x09, 0x04, 0x15, 0x03, 0x09, 0x02, 0x09, 0x04, 0x15, 0x03, 0x09, 0x03, 0x09, 0x03, 0x15, 0x02, 0x09, 0x04, 0x0A, 0x10, 0x07, 0x03,
+    0x08, 0x05, 0x0A, 0x0F, 0x07, 0x04, 0x06, 0x06, 0x0B, 0x0E, 0x07, 0x05, 0x05, 0x07, 0x0C, 0x0C, 0x07, 0x06, 0x03, 0x08, 0x0F, 0x09, 0x07, 0x07,
+    0x01, 0x0A, 0x1E, 0x13, 0x1D, 0x14, 0x1C, 0x15, 0x1B, 0x17, 0x19, 0x18, 0x18, 0x1A, 0x14, 0x1F, 0x0F, 0x11, 0x30, 0x02, 0x2E, 0x04, 0x2B, 0x07,
+    0x28, 0x0A, 0x26, 0x0C, 0x23, 0x0F, 0x21, 0x11, 0x1E, 0x14, 0x1B, 0x17, 0x19, 0x19, 0x16, 0x1C, 0x14, 0x1E, 0x11, 0x21, 0x0F, 0x21, 0x0E, 0x21,
+    0x0E, 0x21, 0x0F, 0x22, 0x0D, 0x25, 0x0B, 0x27, 0x09, 0x29, 0x09, 0x1C, 0x03, 0x0A, 0x09, 0x19, 0x06, 0x0A, 0x09, 0x16, 0x09, 0x0A, 0x09, 0x13,
+    0x0C, 0x0A, 0x09, 0x10, 0x0F, 0x0A, 0x09, 0x10, 0x0F, 0x0A, 0x09, 0x12, 0x0D, 0x0A, 0x09, 0x15, 0x0A, 0x0A, 0x09, 0x18, 0x07, 0x0A, 0x09, 0x1B,
+    0x04, 0x0A, 0x09, 0x1E, 0x01, 0x0A, 0x09, 0x29, 0x0C, 0x26, 0x0F, 0x23, 0x11, 0x22, 0x13, 0x22, 0x12, 0x23, 0x12, 0x22, 0x13, 0x1F, 0x15, 0x1D,
+    0x18, 0x1A, 0x1A, 0x18, 0x1D, 0x15, 0x20, 0x12, 0x22, 0x10, 0x25, 0x0D, 0x27, 0x0B, 0x2A, 0x08, 0x2D, 0x05, 0x2F, 0x03, 0x31, 0x01, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0x95, 0x0B, 0x09, 0x0C, 0x12, 0x0B, 0x09, 0x0C, 0x12, 0x0B, 0x09, 0x0C, 0x12, 0x0B, 0x09, 0x0C, 0x12, 0x0B, 0x09, 0x0C, 0x12,
+    0x0B, 0x09, 0x0C, 0x12, 0x0B, 0x09, 0x0C, 0x12, 0x0A, 0x0A, 0x0C, 0x13, 0x09, 0x0A, 0x0C, 0x13, 0x09, 0x0A, 0x0B, 0x14, 0x09, 0x0A, 0x0B, 0x15,
+    0x07, 0x0C, 0x0A, 0x17, 0x03, 0x0E, 0x09, 0x2A, 0x07, 0x3E, 0x01, 0x30, 0x02, 0x30, 0x02, 0x30, 0x03, 0x2E, 0x05, 0x2D, 0x05, 0x14, 0x01, 0x17,
+    0x07, 0x12, 0x03, 0x15, 0x09, 0x10, 0x04, 0x14, 0x0C, 0x0D, 0x06, 0x12, 0x0F, 0x09, 0x0A, 0x0F, 0x24, 0x0C, 0x2A, 0x05, 0x0C, 0x14, 0x0B, 0x26,
+    0x12, 0x20, 0x16, 0x1C, 0x1A, 0x18, 0x1E, 0x15, 0x20, 0x13, 0x22, 0x11, 0x24, 0x0F, 0x26, 0x0D, 0x28, 0x0B, 0x2A, 0x0A, 0x2A, 0x09, 0x2C, 0x07,
+    0x12, 0x0A, 0x12, 0x06, 0x0F, 0x0F, 0x10, 0x05, 0x0F, 0x12, 0x0F, 0x04, 0x0E, 0x14, 0x0E, 0x04, 0x0D, 0x16, 0x0D, 0x03, 0x0D, 0x18, 0x0D, 0x02,
+    0x0C, 0x1A, 0x0C, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0B, 0x1C, 0x0B, 0x01, 0x0C, 0x1C, 0x0B, 0x01, 0x0C, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x17, 0x1E,
+    0x17, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x0C, 0x01, 0x0B, 0x1C, 0x0B, 0x02, 0x0B, 0x1C, 0x0B, 0x02, 0x0C, 0x1B, 0x0B, 0x02, 0x0C, 0x1A, 0x0C, 0x02,
+    0x0D, 0x19, 0x0C, 0x02, 0x0D, 0x18, 0x0D, 0x03, 0x0D, 0x16, 0x0D, 0x04, 0x0E, 0x14, 0x0E, 0x05, 0x0B, 0x17, 0x0D, 0x05, 0x0A, 0x19, 0x0B, 0x07,
+    0x08, 0x1B, 0x0A, 0x07, 0x07, 0x1D, 0x08, 0x09, 0x05, 0x1F, 0x06, 0x0B, 0x03, 0x21, 0x05, 0x0B, 0x02, 0x23, 0x03, 0x0D, 0x01, 0x24, 0x01, 0x07,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0x97, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16,
+    0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x16, 0x1C, 0x17, 0x1A, 0x0C, 0x01, 0x0B, 0x1A, 0x0B, 0x02, 0x0C, 0x18, 0x0C, 0x02, 0x0C, 0x18, 0x0C, 0x02, 0x0D,
+    0x16, 0x0D, 0x03, 0x0D, 0x14, 0x0D, 0x04, 0x0E, 0x12, 0x0E, 0x05, 0x0F, 0x0E, 0x0F, 0x06, 0x12, 0x08, 0x12, 0x07, 0x2A, 0x08, 0x2A, 0x09, 0x28,
+    0x0B, 0x26, 0x0C, 0x26, 0x0D, 0x24, 0x0F, 0x22, 0x11, 0x20, 0x14, 0x1C, 0x17, 0x1A, 0x1A, 0x16, 0x1F, 0x10, 0x26, 0x08, 0x15, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0x97, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08,
+    0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08,
+    0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08,
+    0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x08, 0x0B, 0x09, 0x16, 0x1C, 0x16, 0x1C, 0x0B, 0x27,
+    0x0B, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x97, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A,
+    0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A,
+    0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A,
+    0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x0A, 0x0A, 0x13, 0x0B, 0x27,
+    0x14, 0x0B, 0x26, 0x12, 0x20, 0x16, 0x1C, 0x1A, 0x18, 0x1E, 0x15, 0x20, 0x13, 0x22, 0x11, 0x24, 0x0F, 0x26, 0x0D, 0x28, 0x0B, 0x2A, 0x0A, 0x2A,
+    0x09, 0x2C, 0x08, 0x11, 0x0A, 0x12, 0x06, 0x10, 0x0F, 0x0F, 0x06, 0x0E, 0x12, 0x0F, 0x04, 0x0E, 0x14, 0x0E, 0x04, 0x0D, 0x16, 0x0D, 0x03, 0x0D,
+    0x18, 0x0D, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0B, 0x1C, 0x0B, 0x02, 0x0B, 0x1C, 0x0B, 0x01, 0x0C, 0x1C, 0x18, 0x1C, 0x18,
+    0x0A, 0x0A, 0x08, 0x18, 0x0A, 0x0A, 0x09, 0x17, 0x0A, 0x0A, 0x08, 0x18, 0x0A, 0x0A, 0x08, 0x18, 0x0A, 0x0B, 0x07, 0x18, 0x0A, 0x0B, 0x07, 0x18,
+    0x0A, 0x0B, 0x07, 0x0B, 0x02, 0x0B, 0x0A, 0x0B, 0x07, 0x0B, 0x02, 0x0C, 0x09, 0x0B, 0x06, 0x0C, 0x02, 0x0C, 0x09, 0x0B, 0x05, 0x0D, 0x02, 0x0D,
+    0x08, 0x0B, 0x05, 0x0C, 0x03, 0x0E, 0x07, 0x0B, 0x04, 0x0D, 0x04, 0x0D, 0x07, 0x0B, 0x02, 0x0F, 0x04, 0x0E, 0x06, 0x1B, 0x06, 0x0F, 0x04, 0x1B,
+    0x06, 0x0E, 0x05, 0x1A, 0x08, 0x0C, 0x06, 0x1A, 0x08, 0x0B, 0x07, 0x19, 0x0A, 0x09, 0x08, 0x18, 0x0C, 0x07, 0x09, 0x17, 0x0D, 0x06, 0x0A, 0x16,
+    0x0F, 0x04, 0x0B, 0x15, 0x11, 0x02, 0x0C, 0x14, 0x20, 0x12, 0x22, 0x10, 0x24, 0x0E, 0x26, 0x0A, 0x14, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x13,
+    0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27,
+    0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x14, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x2B,
+    0x02, 0x30, 0x04, 0x2E, 0x06, 0x2C, 0x08, 0x2A, 0x09, 0x29, 0x0B, 0x27, 0x0C, 0x26, 0x0E, 0x26, 0x0D, 0x27, 0x0C, 0x27, 0x0D, 0x27, 0x0C, 0x27,
+    0x0C, 0x27, 0x0C, 0x28, 0x0B, 0x27, 0x0C, 0x27, 0x0C, 0x27, 0x0C, 0x27, 0x0B, 0x27, 0x0C, 0x26, 0x0D, 0x01, 0x32, 0x01, 0x32, 0x01, 0x31, 0x02,
+    0x31, 0x02, 0x30, 0x03, 0x30, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x2D, 0x06, 0x2C, 0x07, 0x2A, 0x09, 0x28, 0x0B, 0x25, 0x0E, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0x8C, 0x16, 0x04, 0x2C, 0x08, 0x29, 0x0A, 0x27, 0x0C, 0x24, 0x10, 0x21, 0x12, 0x1F, 0x14, 0x1C, 0x18, 0x19, 0x1A, 0x17, 0x1D, 0x14, 0x1F,
+    0x11, 0x22, 0x0F, 0x25, 0x0C, 0x27, 0x09, 0x13, 0x03, 0x15, 0x06, 0x13, 0x06, 0x14, 0x04, 0x13, 0x08, 0x14, 0x02, 0x13, 0x0A, 0x26, 0x0E, 0x23,
+    0x10, 0x21, 0x12, 0x1F, 0x15, 0x1B, 0x18, 0x19, 0x1A, 0x17, 0x1D, 0x14, 0x1F, 0x11, 0x22, 0x0F, 0x25, 0x0C, 0x27, 0x0A, 0x29, 0x07, 0x2D, 0x04,
+    0x2F, 0x02, 0x31, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B,
+    0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B,
+    0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x00, 0xFF, 0x00, 0xF5, 0x01, 0x31, 0x03, 0x2F, 0x04, 0x2E, 0x06, 0x13, 0x21, 0x13, 0x20, 0x13, 0x21, 0x13,
+    0x20, 0x13, 0x21, 0x13, 0x20, 0x13, 0x21, 0x13, 0x20, 0x13, 0x21, 0x13, 0x20, 0x12, 0x22, 0x10, 0x23, 0x0F, 0x25, 0x0D, 0x23, 0x0F, 0x22, 0x10,
+    0x20, 0x12, 0x1F, 0x13, 0x1D, 0x13, 0x1E, 0x13, 0x1D, 0x13, 0x1E, 0x13, 0x1D, 0x13, 0x1E, 0x13, 0x1D, 0x13, 0x1E, 0x13, 0x1D, 0x13, 0x1E, 0x2D,
+    0x03, 0x2F, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x26, 0x00, 0xFF, 0x00, 0xF5, 0x02, 0x30, 0x03, 0x2F, 0x04, 0x2E, 0x05, 0x12, 0x22, 0x11, 0x22, 0x11,
+    0x22, 0x12, 0x21, 0x12, 0x22, 0x11, 0x22, 0x11, 0x22, 0x12, 0x22, 0x11, 0x22, 0x11, 0x22, 0x12, 0x21, 0x12, 0x22, 0x11, 0x22, 0x11, 0x22, 0x12,
+    0x21, 0x12, 0x22, 0x11, 0x22, 0x11, 0x22, 0x12, 0x04, 0x2F, 0x03, 0x30, 0x02, 0x31, 0x01, 0xFF, 0x00, 0xC3, 0x14, 0x0C, 0x25, 0x12, 0x1F, 0x17,
+    0x1C, 0x1A, 0x18, 0x1E, 0x15, 0x20, 0x13, 0x22, 0x11, 0x24, 0x0F, 0x26, 0x0D, 0x28, 0x0B, 0x2A, 0x09, 0x2C, 0x08, 0x2C, 0x07, 0x12, 0x0A, 0x12,
+    0x06, 0x0F, 0x10, 0x0F, 0x05, 0x0F, 0x12, 0x0F, 0x04, 0x0D, 0x16, 0x0D, 0x03, 0x0D, 0x18, 0x0C, 0x03, 0x0D, 0x18, 0x0D, 0x02, 0x0C, 0x1A, 0x0C,
+    0x02, 0x0B, 0x1B, 0x0C, 0x02, 0x0B, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x18, 0x1C, 0x17, 0x1E, 0x16, 0x1E, 0x16, 0x1E, 0x16, 0x1D, 0x18, 0x1C, 0x18,
+    0x1C, 0x0C, 0x01, 0x0B, 0x1C, 0x0C, 0x01, 0x0B, 0x1C, 0x0B, 0x02, 0x0C, 0x1A, 0x0C, 0x02, 0x0D, 0x18, 0x0D, 0x02, 0x0D, 0x18, 0x0D, 0x03, 0x0D,
+    0x16, 0x0D, 0x04, 0x0E, 0x14, 0x0E, 0x05, 0x0F, 0x10, 0x0F, 0x06, 0x11, 0x0C, 0x11, 0x07, 0x2C, 0x08, 0x2C, 0x09, 0x2A, 0x0B, 0x28, 0x0C, 0x28,
+    0x0D, 0x26, 0x0F, 0x24, 0x11, 0x22, 0x14, 0x1E, 0x17, 0x1C, 0x1A, 0x18, 0x1E, 0x14, 0x23, 0x0E, 0x13, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x0E,
+    0x09, 0x12, 0x09, 0x0E, 0x09, 0x12, 0x09, 0x0E, 0x09, 0x12, 0x09, 0x0E, 0x09, 0x12, 0x09, 0x0E, 0x09, 0x12, 0x09, 0x0E, 0x09, 0x12, 0x09, 0x0E,
+    0x09, 0x12, 0x09, 0x0E, 0x09, 0x12, 0x0A, 0x0D, 0x09, 0x12, 0x0A, 0x0C, 0x0A, 0x12, 0x0A, 0x0C, 0x0A, 0x12, 0x0B, 0x0A, 0x0B, 0x12, 0x0C, 0x09,
+    0x0B, 0x12, 0x0D, 0x06, 0x0D, 0x13, 0x1F, 0x13, 0x1E, 0x14, 0x1E, 0x15, 0x1C, 0x16, 0x1C, 0x17, 0x1A, 0x18, 0x1A, 0x19, 0x18, 0x1B, 0x16, 0x1D,
+    0x14, 0x20, 0x10, 0x24, 0x0C, 0x2B, 0x03, 0x20, 0x14, 0x0B, 0x29, 0x12, 0x22, 0x17, 0x1F, 0x1A, 0x1B, 0x1E, 0x18, 0x20, 0x16, 0x22, 0x14, 0x24,
+    0x12, 0x26, 0x10, 0x28, 0x0E, 0x2A, 0x0C, 0x2C, 0x0B, 0x2C, 0x0A, 0x12, 0x0A, 0x12, 0x09, 0x0F, 0x10, 0x0F, 0x08, 0x0F, 0x12, 0x0F, 0x07, 0x0D,
+    0x16, 0x0D, 0x06, 0x0D, 0x18, 0x0C, 0x06, 0x0D, 0x18, 0x0D, 0x05, 0x0C, 0x1A, 0x0C, 0x05, 0x0C, 0x1A, 0x0C, 0x05, 0x0B, 0x1C, 0x0C, 0x03, 0x0C,
+    0x1C, 0x0C, 0x03, 0x0C, 0x1C, 0x0C, 0x03, 0x0C, 0x1C, 0x0C, 0x03, 0x0B, 0x14, 0x01, 0x09, 0x0B, 0x03, 0x0B, 0x13, 0x03, 0x08, 0x0B, 0x03, 0x0B,
+    0x12, 0x05, 0x07, 0x0B, 0x03, 0x0B, 0x11, 0x07, 0x05, 0x0C, 0x03, 0x0C, 0x0F, 0x09, 0x04, 0x0C, 0x03, 0x0C, 0x0E, 0x0B, 0x03, 0x0C, 0x04, 0x0B,
+    0x0C, 0x0E, 0x02, 0x0C, 0x04, 0x0B, 0x0D, 0x0E, 0x01, 0x0B, 0x05, 0x0C, 0x0D, 0x19, 0x05, 0x0D, 0x0D, 0x18, 0x05, 0x0D, 0x0E, 0x17, 0x06, 0x0D,
+    0x0E, 0x15, 0x07, 0x0E, 0x0E, 0x14, 0x08, 0x0F, 0x0D, 0x12, 0x09, 0x11, 0x0C, 0x11, 0x0A, 0x2C, 0x0B, 0x2C, 0x0C, 0x2C, 0x0C, 0x2C, 0x0B, 0x2D,
+    0x0B, 0x2D, 0x0B, 0x2D, 0x0B, 0x2D, 0x0C, 0x2C, 0x0C, 0x1C, 0x02, 0x0D, 0x0E, 0x18, 0x05, 0x0B, 0x11, 0x14, 0x08, 0x09, 0x15, 0x0E, 0x0C, 0x07,
+    0x31, 0x05, 0x33, 0x03, 0x35, 0x01, 0x06, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x95, 0x0C, 0x09, 0x14, 0x09, 0x0C, 0x0A, 0x13, 0x09, 0x0C, 0x0B, 0x12,
+    0x09, 0x0C, 0x0D, 0x10, 0x09, 0x0C, 0x0E, 0x0F, 0x09, 0x0C, 0x10, 0x0D, 0x09, 0x0C, 0x11, 0x0C, 0x09, 0x0C, 0x13, 0x0A, 0x0A, 0x0B, 0x14, 0x09,
+    0x0A, 0x0A, 0x17, 0x07, 0x0A, 0x0A, 0x18, 0x06, 0x0B, 0x08, 0x1B, 0x04, 0x0C, 0x06, 0x1D, 0x03, 0x31, 0x02, 0x1C, 0x01, 0x14, 0x01, 0x1C, 0x02,
+    0x13, 0x01, 0x1B, 0x05, 0x11, 0x02, 0x1A, 0x06, 0x10, 0x02, 0x19, 0x09, 0x0E, 0x03, 0x18, 0x0A, 0x0D, 0x04, 0x16, 0x0C, 0x0C, 0x05, 0x14, 0x0F,
+    0x0A, 0x06, 0x12, 0x11, 0x09, 0x07, 0x10, 0x13, 0x08, 0x09, 0x0C, 0x17, 0x06, 0x0C, 0x06, 0x1B, 0x05, 0x2E, 0x04, 0x30, 0x02, 0x31, 0x01, 0x2B,
+    0x02, 0x31, 0x04, 0x2F, 0x05, 0x12, 0x07, 0x15, 0x07, 0x0E, 0x0D, 0x11, 0x09, 0x0B, 0x10, 0x0F, 0x0B, 0x09, 0x13, 0x0C, 0x0C, 0x08, 0x15, 0x0A,
+    0x0E, 0x06, 0x16, 0x0B, 0x0D, 0x05, 0x18, 0x0B, 0x0C, 0x05, 0x19, 0x0A, 0x0D, 0x03, 0x1A, 0x0B, 0x0C, 0x03, 0x1B, 0x0B, 0x0B, 0x02, 0x1C, 0x0B,
+    0x0B, 0x02, 0x1D, 0x0B, 0x0A, 0x02, 0x1D, 0x0B, 0x0A, 0x02, 0x0B, 0x04, 0x0E, 0x0B, 0x0B, 0x01, 0x0A, 0x06, 0x0E, 0x0A, 0x16, 0x07, 0x0D, 0x0A,
+    0x16, 0x07, 0x0D, 0x0A, 0x16, 0x08, 0x0D, 0x09, 0x16, 0x08, 0x0D, 0x09, 0x16, 0x08, 0x0E, 0x08, 0x16, 0x09, 0x0D, 0x08, 0x16, 0x09, 0x0E, 0x07,
+    0x0A, 0x02, 0x0A, 0x0A, 0x0E, 0x05, 0x0B, 0x02, 0x0B, 0x09, 0x0F, 0x02, 0x0D, 0x02, 0x0B, 0x09, 0x1E, 0x02, 0x0C, 0x09, 0x1C, 0x03, 0x0D, 0x08,
+    0x1C, 0x04, 0x0D, 0x08, 0x1B, 0x04, 0x0D, 0x08, 0x1A, 0x05, 0x0C, 0x0A, 0x19, 0x06, 0x0A, 0x0B, 0x18, 0x07, 0x09, 0x0D, 0x16, 0x09, 0x07, 0x0F,
+    0x14, 0x0B, 0x05, 0x11, 0x12, 0x0D, 0x03, 0x14, 0x0E, 0x10, 0x01, 0x18, 0x09, 0x0B, 0x00, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B,
+    0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0xFF,
+    0x00, 0xFF, 0x00, 0x65, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B,
+    0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x0B, 0x27, 0x00, 0x24, 0x0F, 0x27, 0x0C, 0x29, 0x0A, 0x2B, 0x08, 0x2C, 0x07, 0x2D, 0x06, 0x2E, 0x05,
+    0x2F, 0x04, 0x2F, 0x04, 0x30, 0x03, 0x31, 0x02, 0x31, 0x23, 0x10, 0x26, 0x0E, 0x26, 0x0D, 0x27, 0x0C, 0x28, 0x0B, 0x28, 0x0C, 0x27, 0x0C, 0x27,
+    0x0C, 0x28, 0x0B, 0x28, 0x0B, 0x27, 0x0C, 0x27, 0x0C, 0x27, 0x0C, 0x27, 0x0B, 0x27, 0x0C, 0x26, 0x0D, 0x25, 0x0E, 0x22, 0x10, 0x02, 0x31, 0x02,
+    0x30, 0x03, 0x30, 0x03, 0x2F, 0x04, 0x2F, 0x04, 0x2E, 0x05, 0x2D, 0x06, 0x2C, 0x07, 0x2B, 0x08, 0x29, 0x0A, 0x27, 0x0C, 0x24, 0x0F, 0x00, 0x02,
+    0x30, 0x05, 0x2D, 0x07, 0x2B, 0x0A, 0x28, 0x0D, 0x25, 0x0F, 0x23, 0x12, 0x20, 0x15, 0x1D, 0x17, 0x1B, 0x1A, 0x18, 0x1D, 0x15, 0x1F, 0x13, 0x22,
+    0x11, 0x23, 0x12, 0x23, 0x11, 0x24, 0x11, 0x23, 0x12, 0x23, 0x12, 0x23, 0x12, 0x20, 0x15, 0x1D, 0x18, 0x1A, 0x1B, 0x17, 0x1D, 0x15, 0x20, 0x12,
+    0x1D, 0x15, 0x1A, 0x18, 0x18, 0x1A, 0x15, 0x1D, 0x12, 0x20, 0x0F, 0x22, 0x0D, 0x22, 0x0E, 0x22, 0x0D, 0x22, 0x0D, 0x22, 0x0D, 0x23, 0x0E, 0x21,
+    0x11, 0x1E, 0x14, 0x1C, 0x16, 0x19, 0x19, 0x17, 0x1B, 0x14, 0x1E, 0x11, 0x21, 0x0F, 0x23, 0x0C, 0x26, 0x09, 0x29, 0x07, 0x2B, 0x04, 0x2E, 0x02,
+    0x30, 0x00, 0x02, 0x30, 0x05, 0x2D, 0x08, 0x2A, 0x0B, 0x27, 0x0E, 0x24, 0x12, 0x20, 0x15, 0x1D, 0x18, 0x1A, 0x1B, 0x17, 0x1E, 0x14, 0x21, 0x11,
+    0x24, 0x0E, 0x28, 0x0E, 0x27, 0x0E, 0x27, 0x0E, 0x27, 0x0F, 0x24, 0x11, 0x21, 0x15, 0x1D, 0x18, 0x1A, 0x1B, 0x17, 0x1C, 0x16, 0x18, 0x1A, 0x15,
+    0x1D, 0x12, 0x20, 0x0E, 0x24, 0x0B, 0x25, 0x09, 0x26, 0x09, 0x26, 0x09, 0x25, 0x0C, 0x23, 0x0F, 0x1F, 0x13, 0x1C, 0x16, 0x18, 0x1A, 0x15, 0x1D,
+    0x17, 0x1B, 0x1A, 0x18, 0x1E, 0x14, 0x21, 0x11, 0x25, 0x10, 0x25, 0x10, 0x25, 0x10, 0x26, 0x10, 0x25, 0x10, 0x22, 0x14, 0x1E, 0x17, 0x1B, 0x1A,
+    0x18, 0x1D, 0x15, 0x1A, 0x18, 0x16, 0x1C, 0x13, 0x1F, 0x0F, 0x23, 0x0C, 0x26, 0x09, 0x26, 0x08, 0x27, 0x08, 0x27, 0x09, 0x26, 0x0C, 0x23, 0x0F,
+    0x1F, 0x13, 0x1C, 0x16, 0x19, 0x19, 0x16, 0x1C, 0x13, 0x1F, 0x10, 0x22, 0x0D, 0x25, 0x09, 0x29, 0x06, 0x2C, 0x03, 0x2F, 0x01, 0x31, 0x31, 0x02,
+    0x2E, 0x06, 0x2B, 0x08, 0x29, 0x0B, 0x25, 0x0E, 0x23, 0x11, 0x1F, 0x14, 0x1D, 0x16, 0x1A, 0x1A, 0x17, 0x1C, 0x14, 0x20, 0x11, 0x22, 0x0E, 0x26,
+    0x0B, 0x28, 0x08, 0x15, 0x01, 0x16, 0x05, 0x15, 0x03, 0x16, 0x02, 0x15, 0x07, 0x2A, 0x0A, 0x26, 0x0D, 0x23, 0x11, 0x20, 0x13, 0x1D, 0x17, 0x1A,
+    0x19, 0x17, 0x1D, 0x14, 0x1E, 0x15, 0x1B, 0x19, 0x17, 0x1D, 0x14, 0x1F, 0x11, 0x23, 0x0E, 0x25, 0x0B, 0x29, 0x07, 0x16, 0x01, 0x16, 0x04, 0x15,
+    0x04, 0x16, 0x02, 0x15, 0x07, 0x29, 0x0A, 0x27, 0x0D, 0x23, 0x10, 0x21, 0x13, 0x1D, 0x16, 0x1B, 0x19, 0x17, 0x1C, 0x15, 0x1F, 0x11, 0x22, 0x0F,
+    0x25, 0x0B, 0x28, 0x09, 0x2B, 0x05, 0x2E, 0x03, 0x31, 0x01, 0x00, 0x01, 0x31, 0x03, 0x2F, 0x05, 0x2D, 0x07, 0x2B, 0x08, 0x2A, 0x0A, 0x28, 0x0C,
+    0x26, 0x0D, 0x25, 0x0F, 0x23, 0x11, 0x21, 0x12, 0x20, 0x14, 0x1E, 0x16, 0x1C, 0x17, 0x1C, 0x18, 0x1C, 0x18, 0x1B, 0x18, 0x1C, 0x2C, 0x08, 0x2A,
+    0x0A, 0x28, 0x0B, 0x27, 0x0D, 0x25, 0x0F, 0x23, 0x11, 0x21, 0x0F, 0x23, 0x0E, 0x24, 0x0C, 0x26, 0x0A, 0x28, 0x08, 0x2A, 0x06, 0x2C, 0x05, 0x17,
+    0x19, 0x17, 0x19, 0x18, 0x19, 0x17, 0x1B, 0x15, 0x1D, 0x14, 0x1E, 0x12, 0x20, 0x10, 0x22, 0x0F, 0x23, 0x0D, 0x25, 0x0B, 0x27, 0x0A, 0x28, 0x08,
+    0x2A, 0x06, 0x2C, 0x05, 0x2D, 0x03, 0x2F, 0x01, 0x31, 0x29, 0x14, 0x1C, 0x16, 0x1B, 0x17, 0x19, 0x19, 0x18, 0x1A, 0x17, 0x1B, 0x15, 0x1D, 0x14,
+    0x1E, 0x13, 0x1F, 0x11, 0x21, 0x10, 0x22, 0x0F, 0x23, 0x0D, 0x25, 0x0C, 0x26, 0x0B, 0x27, 0x09, 0x29, 0x08, 0x2A, 0x07, 0x14, 0x01, 0x16, 0x05,
+    0x15, 0x02, 0x16, 0x04, 0x14, 0x04, 0x16, 0x03, 0x14, 0x05, 0x16, 0x01, 0x15, 0x06, 0x2A, 0x08, 0x29, 0x09, 0x28, 0x0A, 0x26, 0x0C, 0x25, 0x0D,
+    0x24, 0x0E, 0x22, 0x10, 0x21, 0x11, 0x20, 0x12, 0x1E, 0x14, 0x1D, 0x15, 0x1C, 0x16, 0x1A, 0x18, 0x19, 0x19, 0x18, 0x1A, 0x16, 0x1C, 0x15, 0x1D,
+    0x0B, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x4E, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29,
+    0x09, 0x00, 0x02, 0x38, 0x06, 0x34, 0x09, 0x31, 0x0D, 0x2D, 0x10, 0x2A, 0x14, 0x26, 0x18, 0x22, 0x1B, 0x1F, 0x1F, 0x1B, 0x23, 0x17, 0x26, 0x18,
+    0x26, 0x18, 0x25, 0x18, 0x26, 0x18, 0x26, 0x17, 0x26, 0x18, 0x24, 0x1A, 0x20, 0x1D, 0x1D, 0x21, 0x19, 0x25, 0x15, 0x28, 0x12, 0x2C, 0x0E, 0x2F,
+    0x0B, 0x33, 0x07, 0x37, 0x03, 0x39, 0x01, 0x00, 0x08, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29,
+    0x11, 0x29, 0xFF, 0x00, 0xFF, 0x00, 0x4F, 0x12, 0x01, 0x11, 0x02, 0x0F, 0x04, 0x0D, 0x06, 0x0B, 0x08, 0x09, 0x0A, 0x08, 0x0B, 0x06, 0x0D, 0x04,
+    0x0F, 0x02, 0x11, 0x01, 0x10, 0x02, 0x0F, 0x04, 0x0D, 0x06, 0x0B, 0x08, 0x09, 0x0A, 0x0A, 0x09, 0x0C, 0x07, 0x0E, 0x05, 0x10, 0x05, 0x10, 0x04,
+    0x10, 0x05, 0x0E, 0x07, 0x0C, 0x09, 0x0A, 0x0B, 0x08, 0x0C, 0x07, 0x0E, 0x05, 0x10, 0x03, 0x12, 0x01, 0x00, 0xFF, 0x00, 0x45, 0x08, 0x02, 0x0D,
+    0x03, 0x0B, 0x05, 0x09, 0x08, 0x07, 0x09, 0x05, 0x0C, 0x04, 0x0C, 0x05, 0x0C, 0x05, 0x0B, 0x06, 0x0B, 0x06, 0x0A, 0x06, 0x0A, 0x07, 0x0A, 0x07,
+    0x09, 0x08, 0x09, 0x08, 0x06, 0x0B, 0x03, 0x0D, 0x02, 0x05, 0x11, 0x02, 0x1C, 0x0E, 0x14, 0x12, 0x10, 0x16, 0x0D, 0x18, 0x0A, 0x1B, 0x09, 0x1C,
+    0x07, 0x1E, 0x05, 0x1F, 0x05, 0x20, 0x03, 0x21, 0x03, 0x22, 0x01, 0x23, 0x01, 0x0F, 0x06, 0x0E, 0x01, 0x0D, 0x09, 0x1A, 0x0B, 0x19, 0x0C, 0x17,
+    0x0D, 0x17, 0x0E, 0x16, 0x0E, 0x0A, 0x01, 0x0B, 0x0E, 0x0A, 0x01, 0x0B, 0x0D, 0x0B, 0x02, 0x0A, 0x0D, 0x0B, 0x02, 0x0B, 0x0C, 0x0A, 0x04, 0x0B,
+    0x0A, 0x0B, 0x05, 0x0B, 0x07, 0x0C, 0x04, 0x22, 0x02, 0x22, 0x02, 0x22, 0x02, 0x22, 0x02, 0x22, 0x02, 0x22, 0x02, 0x22, 0x02, 0x22, 0x02, 0x22,
+    0x02, 0x22, 0x02, 0x22, 0x02, 0x22, 0x01, 0x00, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01,
+    0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x1F, 0x05, 0x0F, 0x13, 0x0B, 0x09, 0x0C, 0x13, 0x0B, 0x0B, 0x0B, 0x13, 0x0B, 0x0C, 0x0B, 0x11, 0x0B, 0x0D,
+    0x0B, 0x11, 0x0B, 0x0E, 0x0A, 0x11, 0x0B, 0x0E, 0x0B, 0x10, 0x0B, 0x0E, 0x0B, 0x10, 0x0B, 0x0E, 0x0B, 0x10, 0x0B, 0x0D, 0x0C, 0x10, 0x0C, 0x0C,
+    0x0C, 0x10, 0x0D, 0x0A, 0x0D, 0x10, 0x0E, 0x08, 0x0D, 0x11, 0x10, 0x03, 0x10, 0x12, 0x22, 0x12, 0x22, 0x12, 0x21, 0x14, 0x20, 0x14, 0x1F, 0x16,
+    0x1D, 0x18, 0x1B, 0x1A, 0x19, 0x1C, 0x17, 0x1F, 0x14, 0x22, 0x10, 0x27, 0x0A, 0x0D, 0x0F, 0x06, 0x1A, 0x0E, 0x14, 0x12, 0x10, 0x15, 0x0E, 0x17,
+    0x0C, 0x19, 0x0A, 0x1B, 0x09, 0x1C, 0x07, 0x1E, 0x05, 0x1F, 0x05, 0x20, 0x03, 0x21, 0x03, 0x22, 0x02, 0x0D, 0x07, 0x0E, 0x01, 0x0D, 0x0A, 0x0C,
+    0x01, 0x0C, 0x0B, 0x0C, 0x01, 0x0B, 0x0D, 0x17, 0x0D, 0x17, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0D, 0x17, 0x0D, 0x0B, 0x01, 0x0C,
+    0x0B, 0x0C, 0x01, 0x0D, 0x09, 0x0D, 0x02, 0x0B, 0x0B, 0x0C, 0x02, 0x0A, 0x0D, 0x0A, 0x04, 0x08, 0x0F, 0x09, 0x04, 0x07, 0x11, 0x07, 0x06, 0x05,
+    0x13, 0x06, 0x07, 0x03, 0x15, 0x04, 0x08, 0x02, 0x17, 0x02, 0x05, 0x21, 0x02, 0x2C, 0x0D, 0x25, 0x12, 0x20, 0x16, 0x1D, 0x18, 0x1B, 0x1A, 0x19,
+    0x1C, 0x17, 0x1E, 0x15, 0x1F, 0x15, 0x20, 0x13, 0x21, 0x13, 0x22, 0x11, 0x23, 0x11, 0x0F, 0x06, 0x0E, 0x11, 0x0D, 0x09, 0x0D, 0x11, 0x0C, 0x0B,
+    0x0D, 0x10, 0x0C, 0x0C, 0x0C, 0x10, 0x0B, 0x0D, 0x0C, 0x10, 0x0B, 0x0E, 0x0B, 0x10, 0x0B, 0x0E, 0x0A, 0x11, 0x0B, 0x0E, 0x0A, 0x11, 0x0B, 0x0E,
+    0x0A, 0x12, 0x0A, 0x0D, 0x0B, 0x12, 0x0B, 0x0C, 0x0A, 0x13, 0x0C, 0x0A, 0x0B, 0x14, 0x0C, 0x07, 0x0C, 0x03, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01,
+    0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x33, 0x01, 0x0E, 0x07, 0x1A, 0x0E, 0x14, 0x12,
+    0x10, 0x15, 0x0E, 0x17, 0x0C, 0x19, 0x0A, 0x1B, 0x08, 0x1D, 0x07, 0x1E, 0x05, 0x1F, 0x05, 0x20, 0x03, 0x21, 0x03, 0x0C, 0x01, 0x15, 0x01, 0x0B,
+    0x03, 0x08, 0x02, 0x0B, 0x01, 0x0A, 0x04, 0x08, 0x03, 0x0A, 0x01, 0x09, 0x05, 0x08, 0x04, 0x09, 0x01, 0x09, 0x05, 0x08, 0x04, 0x13, 0x05, 0x08,
+    0x05, 0x12, 0x05, 0x08, 0x05, 0x12, 0x05, 0x08, 0x05, 0x12, 0x05, 0x08, 0x05, 0x12, 0x05, 0x08, 0x05, 0x12, 0x05, 0x08, 0x05, 0x13, 0x04, 0x08,
+    0x04, 0x09, 0x01, 0x0B, 0x03, 0x08, 0x04, 0x09, 0x02, 0x0C, 0x01, 0x08, 0x04, 0x09, 0x02, 0x15, 0x03, 0x0A, 0x02, 0x15, 0x02, 0x0B, 0x03, 0x14,
+    0x02, 0x0A, 0x05, 0x13, 0x03, 0x09, 0x05, 0x13, 0x04, 0x07, 0x07, 0x12, 0x05, 0x06, 0x08, 0x11, 0x06, 0x04, 0x0A, 0x10, 0x07, 0x02, 0x0D, 0x0E,
+    0x18, 0x0C, 0x1B, 0x08, 0x0F, 0x12, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x2A, 0x0A, 0x22, 0x2A, 0x08,
+    0x2C, 0x06, 0x2E, 0x05, 0x2F, 0x04, 0x30, 0x03, 0x31, 0x02, 0x32, 0x02, 0x32, 0x01, 0x33, 0x01, 0xA8, 0x05, 0x0A, 0x18, 0x0C, 0x06, 0x0A, 0x18,
+    0x0B, 0x07, 0x0A, 0x18, 0x0B, 0x07, 0x0A, 0x18, 0x0B, 0x07, 0x0A, 0x18, 0x0B, 0x07, 0x0A, 0x18, 0x0B, 0x07, 0x0A, 0x18, 0x0C, 0x06, 0x0A, 0x18,
+    0x0B, 0x07, 0x0A, 0x19, 0x09, 0x08, 0x0A, 0x19, 0x08, 0x2D, 0x06, 0x2E, 0x05, 0x30, 0x03, 0x32, 0x01, 0x2F, 0x0D, 0x07, 0x17, 0x01, 0x11, 0x0E,
+    0x12, 0x03, 0x0E, 0x12, 0x0F, 0x05, 0x0B, 0x15, 0x0D, 0x07, 0x09, 0x17, 0x0B, 0x08, 0x08, 0x1A, 0x08, 0x0A, 0x06, 0x1B, 0x07, 0x0B, 0x06, 0x1C,
+    0x05, 0x0D, 0x04, 0x1E, 0x05, 0x0C, 0x03, 0x1F, 0x06, 0x0C, 0x02, 0x20, 0x05, 0x0C, 0x02, 0x20, 0x06, 0x0B, 0x01, 0x21, 0x06, 0x0B, 0x01, 0x0E,
+    0x06, 0x0E, 0x06, 0x0A, 0x01, 0x0C, 0x09, 0x0D, 0x06, 0x0A, 0x01, 0x0B, 0x0B, 0x0C, 0x06, 0x0A, 0x01, 0x0B, 0x0C, 0x0B, 0x06, 0x16, 0x0C, 0x0B,
+    0x06, 0x15, 0x0D, 0x0B, 0x06, 0x15, 0x0D, 0x0A, 0x07, 0x16, 0x0C, 0x0A, 0x06, 0x0B, 0x02, 0x0A, 0x0C, 0x0A, 0x06, 0x0B, 0x02, 0x0A, 0x0B, 0x0B,
+    0x05, 0x0C, 0x02, 0x0B, 0x09, 0x0B, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0C, 0x03, 0x0F, 0x02, 0x30, 0x03, 0x30, 0x03, 0x2F, 0x04, 0x2F, 0x04, 0x2E,
+    0x05, 0x2D, 0x06, 0x2D, 0x06, 0x2C, 0x07, 0x2A, 0x09, 0x29, 0x0A, 0x27, 0x0C, 0x24, 0x0E, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x66, 0x12, 0x0B, 0x28,
+    0x0A, 0x28, 0x0A, 0x29, 0x0A, 0x28, 0x0A, 0x29, 0x0A, 0x29, 0x0B, 0x28, 0x0B, 0x28, 0x0C, 0x27, 0x0D, 0x26, 0x23, 0x10, 0x23, 0x10, 0x23, 0x11,
+    0x22, 0x11, 0x22, 0x11, 0x22, 0x12, 0x21, 0x13, 0x20, 0x13, 0x20, 0x15, 0x1E, 0x16, 0x1D, 0x18, 0x1B, 0x05, 0x04, 0x2E, 0x08, 0x07, 0x22, 0x02,
+    0x0A, 0x06, 0x22, 0x01, 0x0C, 0x05, 0x22, 0x01, 0x0C, 0x05, 0x2F, 0x05, 0x30, 0x04, 0x22, 0x01, 0x0C, 0x05, 0x22, 0x01, 0x0C, 0x05, 0x22, 0x01,
+    0x0C, 0x05, 0x22, 0x02, 0x0A, 0x06, 0x22, 0x02, 0x09, 0x07, 0x22, 0x04, 0x06, 0x08, 0x22, 0x3E, 0x02, 0x41, 0x03, 0x40, 0x05, 0x3E, 0x07, 0x3C,
+    0x08, 0x3B, 0x0A, 0x39, 0x0B, 0x38, 0x0C, 0x39, 0x0B, 0x3A, 0x0B, 0x39, 0x0B, 0x39, 0x0B, 0x38, 0x0C, 0x05, 0x04, 0x2C, 0x0E, 0x04, 0x08, 0x07,
+    0x31, 0x03, 0x0A, 0x06, 0x31, 0x02, 0x0C, 0x05, 0x31, 0x02, 0x0C, 0x05, 0x30, 0x02, 0x0D, 0x05, 0x30, 0x02, 0x0E, 0x04, 0x2F, 0x04, 0x0C, 0x05,
+    0x2F, 0x04, 0x0C, 0x05, 0x2E, 0x05, 0x0C, 0x05, 0x2D, 0x07, 0x0A, 0x06, 0x2B, 0x09, 0x09, 0x07, 0x2A, 0x0C, 0x06, 0x08, 0x26, 0x0C, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0x66, 0x1E, 0x06, 0x2C, 0x08, 0x29, 0x0C, 0x26, 0x0F, 0x22, 0x12, 0x20, 0x15, 0x1C, 0x19, 0x19, 0x1B, 0x16, 0x1F, 0x13, 0x22,
+    0x11, 0x22, 0x11, 0x22, 0x11, 0x0E, 0x03, 0x11, 0x11, 0x0D, 0x06, 0x0F, 0x11, 0x0B, 0x09, 0x0E, 0x11, 0x0A, 0x0C, 0x0C, 0x11, 0x09, 0x0E, 0x0B,
+    0x11, 0x07, 0x12, 0x09, 0x11, 0x06, 0x14, 0x08, 0x11, 0x05, 0x17, 0x06, 0x11, 0x03, 0x1A, 0x05, 0x11, 0x02, 0x1D, 0x03, 0x10, 0x01, 0x20, 0x02,
+    0x32, 0x01, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x66, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x02, 0x0B, 0x18, 0x09, 0x19, 0x0A, 0x19, 0x0A, 0x18, 0x0A, 0x19, 0x0B, 0x18, 0x0B, 0x18, 0x0B,
+    0x18, 0x0C, 0x17, 0x8C, 0x01, 0x22, 0x01, 0x22, 0x02, 0x21, 0x02, 0x21, 0x03, 0x20, 0x04, 0x1F, 0x03, 0x20, 0x02, 0x21, 0x02, 0x21, 0x01, 0x0B,
+    0x18, 0x0A, 0x18, 0x0B, 0x18, 0x0A, 0x19, 0x0A, 0x19, 0x0B, 0x18, 0x0B, 0x18, 0x0C, 0x17, 0x0D, 0x16, 0x69, 0x01, 0x22, 0x01, 0x22, 0x02, 0x21,
+    0x02, 0x21, 0x03, 0x20, 0x04, 0x1F, 0x05, 0x1E, 0x07, 0x1C, 0x09, 0x1A, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x02, 0x0B, 0x18, 0x0A, 0x18, 0x0A, 0x19, 0x0A, 0x18, 0x0A, 0x19, 0x0A,
+    0x19, 0x0B, 0x18, 0x0B, 0x18, 0x0C, 0x17, 0x0D, 0x16, 0x8C, 0x01, 0x22, 0x01, 0x22, 0x02, 0x21, 0x03, 0x20, 0x04, 0x1F, 0x05, 0x1E, 0x06, 0x1D,
+    0x08, 0x1B, 0x0E, 0x07, 0x1A, 0x0D, 0x15, 0x11, 0x11, 0x15, 0x0E, 0x17, 0x0C, 0x19, 0x0A, 0x1B, 0x08, 0x1D, 0x07, 0x1E, 0x05, 0x1F, 0x05, 0x20,
+    0x03, 0x21, 0x03, 0x22, 0x01, 0x0E, 0x07, 0x0E, 0x01, 0x0D, 0x0A, 0x0C, 0x01, 0x0C, 0x0C, 0x0B, 0x01, 0x0B, 0x0D, 0x17, 0x0E, 0x16, 0x0E, 0x16,
+    0x0E, 0x16, 0x0E, 0x16, 0x0E, 0x16, 0x0D, 0x18, 0x0C, 0x0B, 0x01, 0x0D, 0x0A, 0x0C, 0x01, 0x0E, 0x07, 0x0E, 0x02, 0x22, 0x02, 0x21, 0x04, 0x20,
+    0x04, 0x1F, 0x06, 0x1E, 0x06, 0x1D, 0x08, 0x1B, 0x0A, 0x19, 0x0C, 0x17, 0x0E, 0x15, 0x11, 0x11, 0x15, 0x0D, 0x1B, 0x06, 0x0F, 0x01, 0x31, 0x01,
+    0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x0E, 0x05, 0x1E, 0x02,
+    0x0B, 0x09, 0x0C, 0x11, 0x0B, 0x0B, 0x0B, 0x11, 0x0B, 0x0C, 0x0B, 0x10, 0x0A, 0x0D, 0x0B, 0x0F, 0x0B, 0x0E, 0x0A, 0x0F, 0x0B, 0x0E, 0x0A, 0x0F,
+    0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0D, 0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x0E, 0x0D, 0x0A, 0x0D, 0x0E, 0x0E, 0x08, 0x0D, 0x0F,
+    0x10, 0x03, 0x10, 0x10, 0x22, 0x10, 0x22, 0x10, 0x21, 0x12, 0x20, 0x12, 0x1F, 0x14, 0x1D, 0x16, 0x1B, 0x18, 0x19, 0x1A, 0x17, 0x1D, 0x14, 0x20,
+    0x10, 0x25, 0x0A, 0x1B, 0x11, 0x02, 0x2A, 0x0E, 0x22, 0x12, 0x1E, 0x16, 0x1B, 0x18, 0x18, 0x1B, 0x17, 0x1C, 0x15, 0x1E, 0x13, 0x1F, 0x13, 0x20,
+    0x11, 0x21, 0x11, 0x22, 0x0F, 0x23, 0x0F, 0x0F, 0x06, 0x0E, 0x0F, 0x0D, 0x09, 0x0E, 0x0E, 0x0C, 0x0B, 0x0D, 0x0E, 0x0C, 0x0C, 0x0C, 0x0E, 0x0B,
+    0x0D, 0x0C, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0B, 0x0E, 0x0A, 0x0F, 0x0B, 0x0E, 0x0A, 0x0F, 0x0B, 0x0D, 0x0B, 0x10, 0x0A, 0x0D, 0x0B, 0x10, 0x0B,
+    0x0C, 0x0A, 0x12, 0x0B, 0x0A, 0x0B, 0x13, 0x0B, 0x07, 0x0C, 0x12, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31,
+    0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x31, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22,
+    0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x02, 0x0B, 0x18, 0x0A, 0x18, 0x0A, 0x19, 0x0A, 0x18, 0x0B, 0x18, 0x0B, 0x18, 0x0B,
+    0x18, 0x0B, 0x18, 0x0C, 0x17, 0x0B, 0x18, 0x0A, 0x19, 0x08, 0x1B, 0x07, 0x1D, 0x05, 0x1E, 0x03, 0x21, 0x01, 0x20, 0x1E, 0x01, 0x23, 0x03, 0x21,
+    0x04, 0x0D, 0x08, 0x0B, 0x06, 0x0A, 0x0C, 0x08, 0x08, 0x08, 0x0E, 0x06, 0x09, 0x07, 0x10, 0x04, 0x0B, 0x05, 0x11, 0x04, 0x0B, 0x05, 0x12, 0x04,
+    0x0B, 0x03, 0x13, 0x05, 0x0A, 0x03, 0x14, 0x04, 0x0A, 0x02, 0x15, 0x05, 0x09, 0x02, 0x15, 0x05, 0x0A, 0x01, 0x16, 0x04, 0x0A, 0x01, 0x16, 0x04,
+    0x0A, 0x01, 0x0A, 0x02, 0x0A, 0x04, 0x14, 0x03, 0x0A, 0x04, 0x14, 0x04, 0x0A, 0x03, 0x14, 0x04, 0x0A, 0x03, 0x0A, 0x01, 0x09, 0x04, 0x17, 0x01,
+    0x09, 0x05, 0x16, 0x01, 0x0A, 0x04, 0x16, 0x01, 0x0A, 0x04, 0x15, 0x02, 0x0B, 0x03, 0x15, 0x03, 0x0A, 0x04, 0x14, 0x03, 0x0B, 0x03, 0x13, 0x04,
+    0x0A, 0x05, 0x12, 0x05, 0x08, 0x07, 0x10, 0x06, 0x07, 0x08, 0x0F, 0x08, 0x05, 0x0B, 0x0C, 0x0A, 0x03, 0x0E, 0x08, 0x0D, 0x01, 0x1E, 0x0F, 0x0A,
+    0x27, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 0x18, 0xFF, 0x00, 0xFF, 0x00, 0x7F, 0x0F, 0x0A, 0x27, 0x0A, 0x27, 0x0A,
+    0x27, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 0x18, 0x00, 0x19, 0x0A, 0x1B, 0x08, 0x1C, 0x07, 0x1E, 0x05, 0x1F, 0x04, 0x1F, 0x04, 0x20, 0x03,
+    0x21, 0x02, 0x21, 0x02, 0x22, 0x01, 0x22, 0x01, 0x22, 0x17, 0x0C, 0x18, 0x0B, 0x19, 0x0B, 0x18, 0x0B, 0x18, 0x0B, 0x18, 0x0B, 0x18, 0x0B, 0x17,
+    0x0B, 0x16, 0x0D, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x21, 0x02, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x04, 0x1E, 0x05, 0x1D, 0x06, 0x1C, 0x07,
+    0x1A, 0x09, 0x18, 0x0B, 0x00, 0x01, 0x21, 0x03, 0x1F, 0x06, 0x1C, 0x08, 0x1A, 0x0B, 0x17, 0x0D, 0x15, 0x10, 0x12, 0x12, 0x10, 0x15, 0x0D, 0x17,
+    0x0B, 0x1A, 0x08, 0x1C, 0x06, 0x1E, 0x05, 0x20, 0x05, 0x1E, 0x07, 0x1B, 0x0B, 0x17, 0x0E, 0x14, 0x11, 0x11, 0x14, 0x0E, 0x11, 0x11, 0x0E, 0x14,
+    0x0B, 0x17, 0x07, 0x1B, 0x04, 0x1E, 0x01, 0x1F, 0x02, 0x1E, 0x04, 0x1B, 0x07, 0x19, 0x09, 0x16, 0x0C, 0x14, 0x0E, 0x12, 0x10, 0x0F, 0x13, 0x0D,
+    0x15, 0x0A, 0x18, 0x08, 0x1A, 0x05, 0x1D, 0x03, 0x1F, 0x01, 0x21, 0x00, 0x01, 0x21, 0x04, 0x1E, 0x07, 0x1B, 0x0A, 0x18, 0x0D, 0x15, 0x10, 0x12,
+    0x13, 0x0F, 0x17, 0x0B, 0x1A, 0x08, 0x1D, 0x05, 0x20, 0x02, 0x22, 0x01, 0x21, 0x05, 0x1D, 0x09, 0x19, 0x0D, 0x15, 0x11, 0x11, 0x11, 0x11, 0x0D,
+    0x15, 0x0A, 0x18, 0x07, 0x1B, 0x03, 0x40, 0x01, 0x1D, 0x05, 0x1A, 0x08, 0x17, 0x0B, 0x14, 0x0E, 0x11, 0x11, 0x10, 0x12, 0x13, 0x0F, 0x16, 0x0C,
+    0x19, 0x09, 0x1D, 0x05, 0x20, 0x04, 0x20, 0x06, 0x1C, 0x09, 0x19, 0x0C, 0x16, 0x0F, 0x13, 0x12, 0x10, 0x0E, 0x14, 0x0A, 0x18, 0x07, 0x1B, 0x03,
+    0x62, 0x01, 0x1E, 0x04, 0x1B, 0x07, 0x18, 0x0A, 0x15, 0x0D, 0x12, 0x10, 0x0E, 0x14, 0x0B, 0x17, 0x08, 0x1A, 0x05, 0x1D, 0x02, 0x20, 0x21, 0x02,
+    0x1F, 0x04, 0x1C, 0x08, 0x19, 0x0A, 0x17, 0x0D, 0x13, 0x10, 0x11, 0x12, 0x0E, 0x16, 0x0B, 0x18, 0x08, 0x1C, 0x05, 0x1E, 0x03, 0x74, 0x02, 0x1E,
+    0x06, 0x1B, 0x09, 0x17, 0x0D, 0x14, 0x0F, 0x12, 0x10, 0x14, 0x0C, 0x18, 0x09, 0x1A, 0x06, 0x1E, 0x02, 0x75, 0x02, 0x1F, 0x05, 0x1B, 0x08, 0x19,
+    0x0B, 0x15, 0x0E, 0x13, 0x11, 0x0F, 0x14, 0x0D, 0x17, 0x09, 0x1A, 0x07, 0x1D, 0x04, 0x1F, 0x02, 0x21, 0x01, 0x00, 0x01, 0x30, 0x03, 0x2E, 0x06,
+    0x2B, 0x08, 0x29, 0x0B, 0x26, 0x0D, 0x24, 0x10, 0x1F, 0x14, 0x1B, 0x19, 0x15, 0x1E, 0x11, 0x23, 0x0C, 0x27, 0x08, 0x2C, 0x03, 0x0F, 0x01, 0x30,
+    0x04, 0x2D, 0x07, 0x2A, 0x0B, 0x26, 0x0E, 0x23, 0x11, 0x1F, 0x13, 0x1B, 0x13, 0x1C, 0x11, 0x1D, 0x11, 0x1E, 0x10, 0x1E, 0x0F, 0x20, 0x10, 0x1E,
+    0x13, 0x1C, 0x15, 0x19, 0x18, 0x17, 0x1A, 0x15, 0x1C, 0x12, 0x1F, 0x10, 0x21, 0x0D, 0x24, 0x0B, 0x26, 0x08, 0x29, 0x06, 0x2B, 0x04, 0x2D, 0x01,
+    0x30, 0x19, 0x13, 0x0E, 0x14, 0x0D, 0x15, 0x0C, 0x16, 0x0B, 0x17, 0x09, 0x19, 0x08, 0x1A, 0x07, 0x1B, 0x06, 0x1C, 0x05, 0x1D, 0x03, 0x1F, 0x02,
+    0x20, 0x01, 0xB6, 0x01, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x04, 0x1C, 0x06, 0x1B, 0x07, 0x1A, 0x08, 0x19, 0x09, 0x18, 0x0A, 0x16, 0x0C, 0x15, 0x0D,
+    0x14, 0x0E, 0x13, 0x0F, 0x12, 0x10, 0x0A, 0x18, 0x09, 0x31, 0x09, 0x31, 0x09, 0x31, 0x09, 0x21, 0x05, 0x0B, 0x0A, 0x0B, 0x04, 0x0E, 0x2F, 0x0A,
+    0x32, 0x07, 0x34, 0x05, 0x36, 0x03, 0x37, 0x03, 0x38, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0x1C, 0x01, 0x1B, 0x03, 0x1B, 0x01, 0x0B, 0x02,
+    0x0C, 0x07, 0x0C, 0x02, 0x15, 0x27, 0x13, 0x28, 0x12, 0x28, 0x11, 0x29, 0x11, 0x29, 0x11, 0x29, 0x09, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xC2, 0x00,
+    0x08, 0x29, 0x11, 0x29, 0x11, 0x29, 0x12, 0x28, 0x12, 0x28, 0x12, 0x27, 0x15, 0x04, 0x0A, 0x07, 0x0A, 0x04, 0x27, 0x04, 0x1A, 0x01, 0x1C, 0x02,
+    0x1B, 0x01, 0x1C, 0x01, 0x1C, 0x02, 0x38, 0x02, 0x37, 0x04, 0x36, 0x05, 0x34, 0x07, 0x32, 0x09, 0x2F, 0x0E, 0x07, 0x09, 0x0A, 0x0A, 0x06, 0x20,
+    0x09, 0x31, 0x09, 0x31, 0x09, 0x31, 0x09, 0x19, 0x06, 0x02, 0x0B, 0x04, 0x09, 0x06, 0x07, 0x08, 0x05, 0x0A, 0x04, 0x0B, 0x02, 0x0C, 0x02, 0x0B,
+    0x02, 0x0B, 0x03, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x0B, 0x04, 0x0A, 0x04, 0x0B,
+    0x04, 0x0A, 0x04, 0x0A, 0x05, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x03, 0x0A, 0x04, 0x0A, 0x04, 0x0A, 0x03, 0x0B, 0x01, 0x0C, 0x03, 0x0B,
+    0x04, 0x09, 0x06, 0x07, 0x08, 0x05, 0x0A, 0x03, 0x0C, 0x01, 0x07};
+
+const GFXglyph Outfit_80036pt7bRleGlyphs[] PROGMEM = {
+    {0, 1, 1, 13, 0, 0},         // 0x20 ' '
+    {1, 14, 52, 21, 3, -50},     // 0x21 '!'
+    {48, 27, 22, 33, 3, -50},    // 0x22 '"'
+    {65, 43, 50, 47, 2, -49},    // 0x23 '#'
+    {200, 38, 64, 43, 2, -56},   // 0x24 '$'
+    {321, 45, 52, 49, 2, -50},   // 0x25 '%'
+    {504, 47, 52, 49, 2, -50},   // 0x26 '&'
+    {651, 12, 22, 18, 3, -50},   // 0x27 "'"
+    {660, 19, 63, 22, 2, -53},   // 0x28 '('
+    {717, 19, 63, 22, 1, -53},   // 0x29 ')'
+    {774, 30, 31, 34, 2, -51},   // 0x2A '*'
+    {869, 34, 35, 40, 3, -40},   // 0x2B '+'
+    {922, 14, 25, 20, 3, -12},   // 0x2C ','
+    {957, 25, 10, 33, 4, -22},   // 0x2D '-'
+    {959, 14, 14, 21, 4, -12},   // 0x2E '.'
+    {980, 27, 58, 27, 0, -53},   // 0x2F '/'
+    {1035, 43, 52, 47, 2, -50},  // 0x30 '0'
+    {1146, 22, 50, 28, 1, -49},  // 0x31 '1'
+    {1172, 38, 51, 41, 1, -50},  // 0x32 '2'
+    {1312, 37, 51, 40, 1, -49},  // 0x33 '3'
+    {1451, 41, 50, 43, 1, -49},  // 0x34 '4'
+    {1552, 37, 51, 40, 1, -49},  // 0x35 '5'
+    {1695, 38, 51, 41, 1, -49},  // 0x36 '6'
+    {1812, 35, 50, 37, 1, -49},  // 0x37 '7'
+    {1885, 36, 52, 40, 2, -50},  // 0x38 '8'
+    {2010, 38, 51, 41, 1, -50},  // 0x39 '9'
+    {2125, 14, 35, 21, 4, -33},  // 0x3A ':'
+    {2176, 14, 46, 20, 3, -33},  // 0x3B ';'
+    {2241, 34, 36, 41, 3, -41},  // 0x3C '<'
+    {2345, 34, 27, 40, 3, -36},  // 0x3D '='
+    {2415, 33, 36, 41, 4, -41},  // 0x3E '>'
+    {2518, 32, 53, 35, 1, -51},  // 0x3F '?'
+    {2619, 48, 48, 54, 3, -39},  // 0x40 '@'
+    {2826, 51, 50, 52, 1, -49},  // 0x41 'A'
+    {2950, 40, 50, 46, 4, -49},  // 0x42 'B'
+    {3045, 46, 52, 49, 2, -50},  // 0x43 'C'
+    {3192, 48, 50, 54, 4, -49},  // 0x44 'D'
+    {3285, 38, 50, 44, 4, -49},  // 0x45 'E'
+    {3385, 36, 50, 42, 4, -49},  // 0x46 'F'
+    {3480, 52, 52, 56, 2, -50},  // 0x47 'G'
+    {3665, 44, 50, 52, 4, -49},  // 0x48 'H'
+    {3713, 13, 50, 22, 4, -49},  // 0x49 'I'
+    {3719, 34, 51, 39, 1, -49},  // 0x4A 'J'
+    {3788, 46, 50, 51, 4, -49},  // 0x4B 'K'
+    {3868, 35, 50, 40, 4, -49},  // 0x4C 'L'
+    {3918, 53, 50, 61, 4, -49},  // 0x4D 'M'
+    {3992, 44, 50, 53, 4, -49},  // 0x4E 'N'
+    {4050, 53, 52, 57, 2, -50},  // 0x4F 'O'
+    {4193, 40, 50, 45, 4, -49},  // 0x50 'P'
+    {4280, 56, 55, 58, 2, -50},  // 0x51 'Q'
+    {4471, 42, 50, 47, 4, -49},  // 0x52 'R'
+    {4583, 39, 52, 42, 1, -50},  // 0x53 'S'
+    {4742, 43, 50, 46, 1, -49},  // 0x54 'T'
+    {4809, 42, 51, 50, 4, -49},  // 0x55 'U'
+    {4894, 49, 50, 51, 1, -49},  // 0x56 'V'
+    {4993, 70, 50, 71, 1, -49},  // 0x57 'W'
+    {5134, 49, 50, 51, 1, -49},  // 0x58 'X'
+    {5242, 47, 50, 49, 1, -49},  // 0x59 'Y'
+    {5337, 39, 50, 44, 2, -49},  // 0x5A 'Z'
+    {5425, 19, 58, 25, 4, -50},  // 0x5B '['
+    {5449, 27, 58, 27, 0, -53},  // 0x5C '\\'
+    {5503, 19, 58, 25, 2, -50},  // 0x5D ']'
+    {5527, 29, 19, 33, 2, -50},  // 0x5E '^'
+    {5585, 36, 9, 36, 0, 4},     // 0x5F '_'
+    {5589, 18, 16, 24, 3, -51},  // 0x60 '`'
+    {5626, 38, 36, 43, 1, -34},  // 0x61 'a'
+    {5719, 37, 52, 43, 4, -50},  // 0x62 'b'
+    {5822, 33, 36, 35, 1, -34},  // 0x63 'c'
+    {5915, 38, 52, 43, 1, -50},  // 0x64 'd'
+    {6018, 37, 36, 39, 1, -34},  // 0x65 'e'
+    {6149, 35, 52, 32, 0, -51},  // 0x66 'f'
+    {6234, 37, 51, 41, 1, -34},  // 0x67 'g'
+    {6375, 34, 51, 41, 4, -50},  // 0x68 'h'
+    {6425, 13, 52, 19, 3, -51},  // 0x69 'i'
+    {6471, 26, 68, 20, -9, -51}, // 0x6A 'j'
+    {6550, 36, 51, 40, 4, -50},  // 0x6B 'k'
+    {6626, 12, 51, 19, 4, -50},  // 0x6C 'l'
+    {6632, 55, 35, 62, 4, -34},  // 0x6D 'm'
+    {6732, 34, 35, 41, 4, -34},  // 0x6E 'n'
+    {6794, 39, 36, 41, 1, -34},  // 0x6F 'o'
+    {6885, 37, 50, 43, 4, -34},  // 0x70 'p'
+    {6988, 38, 50, 43, 1, -34},  // 0x71 'q'
+    {7090, 28, 35, 32, 4, -34},  // 0x72 'r'
+    {7147, 32, 37, 33, 0, -35},  // 0x73 's'
+    {7270, 27, 49, 29, 1, -48},  // 0x74 't'
+    {7305, 33, 35, 39, 3, -33},  // 0x75 'u'
+    {7372, 39, 34, 39, 0, -33},  // 0x76 'v'
+    {7451, 56, 34, 56, 0, -33},  // 0x77 'w'
+    {7558, 39, 34, 39, 0, -33},  // 0x78 'x'
+    {7626, 38, 49, 38, 0, -33},  // 0x79 'y'
+    {7705, 31, 34, 35, 2, -33},  // 0x7A 'z'
+    {7759, 21, 58, 25, 1, -50},  // 0x7B '{'
+    {7817, 11, 64, 22, 5, -54},  // 0x7C '|'
+    {7823, 21, 58, 25, 2, -50},  // 0x7D '}'
+    {7880, 37, 14, 43, 3, -31}}; // 0x7E '~'
+
+const RleFont Outfit_80036pt7bRle PROGMEM = {{(uint8_t *)Outfit_80036pt7bRuns, (GFXglyph *)Outfit_80036pt7bRleGlyphs, 0x20, 0x7E, 89}};
+
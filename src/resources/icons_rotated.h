@@ -0,0 +1,87 @@
+#pragma once
+
+#include "Arduino.h"
+
+// Generated by tools/rotate_bitmaps.py from icons.h, do not edit
+// Rotated into the panel orientation for rotation 1, draw them with RotatedCanvas::drawRotatedBitmap()
+
+// 28x28
+const unsigned char icon_wifi_small_r1[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0xe0, 0x00,
+    0x00, 0x00, 0x70, 0x00, 0x00, 0x0c, 0x38, 0x00, 0x00, 0x0e, 0x38, 0x00, 0x00, 0x0f, 0x1c, 0x00,
+    0x00, 0xc7, 0x0c, 0x00, 0x00, 0xe3, 0x8e, 0x00, 0x00, 0xe3, 0x8e, 0x00, 0x00, 0x71, 0x8e, 0x00,
+    0x00, 0x71, 0xc6, 0x00, 0x0e, 0x31, 0xc6, 0x00, 0x0e, 0x31, 0xc6, 0x00, 0x00, 0x71, 0xc6, 0x00,
+    0x00, 0x71, 0x8e, 0x00, 0x00, 0xe1, 0x8e, 0x00, 0x00, 0xe3, 0x8e, 0x00, 0x00, 0xc7, 0x0c, 0x00,
+    0x00, 0x0f, 0x1c, 0x00, 0x00, 0x0e, 0x38, 0x00, 0x00, 0x0c, 0x38, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// 28x28
+const unsigned char icon_no_ble_small_r1[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x30, 0x00, 0x01, 0x80, 0x70, 0x00,
+    0x01, 0x80, 0xe0, 0x00, 0x01, 0xc0, 0xc0, 0x00, 0x00, 0xe1, 0xc0, 0x00, 0x1f, 0xf3, 0x8f, 0x80,
+    0x3f, 0xf3, 0x1f, 0xc0, 0x1f, 0xf7, 0x0f, 0x80, 0x0e, 0xee, 0x07, 0x00, 0x0f, 0xed, 0x8e, 0x00,
+    0x07, 0xdd, 0xde, 0x00, 0x03, 0xb8, 0xfc, 0x00, 0x01, 0xb0, 0x78, 0x00, 0x00, 0x70, 0x30, 0x00,
+    0x00, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x01, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// 28x28
+const unsigned char epd_bitmap_icon_battery_0_small_r1[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// 28x28
+const unsigned char epd_bitmap_icon_battery_20_small_r1[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// 28x28
+const unsigned char epd_bitmap_icon_battery_40_small_r1[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// 28x28
+const unsigned char epd_bitmap_icon_battery_60_small_r1[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x9f, 0x98, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// 28x28
+const unsigned char epd_bitmap_icon_battery_80_small_r1[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x9f, 0x98, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// 28x28
+const unsigned char epd_bitmap_icon_battery_100_small_r1[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00,
+    0x01, 0x80, 0x18, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0x9f, 0x98, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x9f, 0x98, 0x00, 0x01, 0x80, 0x18, 0x00,
+    0x01, 0xbf, 0xd8, 0x00, 0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xbf, 0xd8, 0x00,
+    0x01, 0xbf, 0xd8, 0x00, 0x01, 0x80, 0x18, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
@@ -3,47 +3,56 @@
 // Setup
 
 // When the watch is first powered on, we need to initialize the time
-// We use the old existing time which is stored in the preferences
+// We use the old existing time which is stored in the hot state (or its checkpoint in the preferences)
 // Then we atttempt to fetch the time from the server, so on the 2nd cycle the time will be updated
 //
-void wakeupInit(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences) {
+void wakeupInit(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, FrameRenderer *renderer, ESP32Time *rtc,
+                Preferences *preferences) {
   log(LogLevel::INFO, "WAKEUP_INIT");
+  governorBegin();
 
   // ?? why add 15?
-  rtc->setTime(preferences->getLong64("prev_time_unix", 0) + 15);
-
-  // Get the battery status from the preferences
-  calculateBatteryStatus(preferences);
-  int batteryStatus = preferences->getInt("battery_level", 0);
-  drawHomeUI(display, rtc, batteryStatus);
+  rtc->setTime(hotState().prevTimeUnix + 15);
+  timekeeperTimeSet();
 
+  // Get the battery status
+  int batteryStatus = calculateBatteryStatus();
+  schedulerRan(ScheduledJob::BATTERY);
   // We do not display the weather on the init screen, its probably outdated anyway
-  // displayWeather(display, preferences->getString("weather_c"), preferences->getString("weather_t"));
-  displayFocusTime(display, preferences->getInt("focus_time", 0));
+  {
+    CPU_PHASE(CpuPhase::RENDER);
+    updateHomeUI(renderer->canvas(), rtc, batteryStatus, hotState().focusTime, "", "", true);
+  }
+
+  // Update the time & weather on the other core while this one refreshes the display
+  bool network = beginWiFiActions(preferences);
 
   // Re-draw the display
-  display->update();
+  {
+    CPU_PHASE(CpuPhase::EPD);
+    renderer->flushFull();
+  }
 
-  // Update the time & weather
-  performWiFiActions(display, preferences);
+  if (network) {
+    finishWiFiActions(renderer);
+  }
 }
 
-void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences) {
+void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, FrameRenderer *renderer, ESP32Time *rtc,
+                 Preferences *preferences) {
   log(LogLevel::INFO, "WAKEUP_LIGHT");
-  setCpuFrequencyMhz(80);
+  governorBegin();
 
-  // Get the battery status from the preferences
-  int batteryStatus = preferences->getInt("battery_level", 0);
-  // Get the focus time
-  int focusTime = preferences->getInt("focus_time", 0);
+  // Get the battery status and the focus time, they are in RTC memory
+  int batteryStatus = hotState().batteryLevel;
+  int focusTime = hotState().focusTime;
   bool initAlarm = false;
   // When starting the focus time should be 25
   // Decrease the focus time, by 1 minute
   if (focusTime > 0) {
     focusTime--;
     // Reduce the focus time by 1 minute
-    // Update the focus time in the preferences
-    preferences->putInt("focus_time", focusTime);
+    hotStateSetFocusTime(focusTime);
     // Serial.println("focusTime: " + String(focusTime));
     if (focusTime == 0) { // Needs to be done AFTER updating the display
       // Play the alarm sound
@@ -51,24 +60,38 @@ void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class
     }
   }
 
-  // Draw the time and date
-  drawHomeUI(display, rtc, batteryStatus);
-  // Get the weather from the preferences and display it
-  displayWeather(display, preferences->getString("weather_c"), preferences->getString("weather_t"));
-  displayFocusTime(display, focusTime);
+  // The panel still shows the frame from the previous wake, put it back into the canvas so that we only
+  // have to draw the elements which changed (usually just the time). Without it everything is drawn again
+  bool restored = renderer->restore();
+
+  // A new hour shows the forecast for it
+  forecastUpdateWeather(preferences, rtc->getEpoch());
+
+  // Draw the time and date + battery, weather and focus time
+  timekeeperMarkRender();
+  {
+    CPU_PHASE(CpuPhase::RENDER);
+    updateHomeUI(renderer->canvas(), rtc, batteryStatus, focusTime, hotState().weatherCondition, hotState().weatherTemp, !restored);
+  }
+  hotStateSetTime(rtc->getEpoch());
+
+  // Perform the WiFi actions every 12 hours, the forecast covers the hours in between
+  // They run on the other core while this one refreshes the display
+  bool network = schedulerTake(ScheduledJob::WIFI, batteryStatus) && beginWiFiActions(preferences);
 
   // Refresh the display
   // display->update();  // Gives us nasty flicking
   // Perform an update of the display using the window function which is faster and more power efficient
-  // However, we do have to update the complete screen. I tried small parts of the screen, but it was not
-  // working as we got corrupted parts of the screen as the background is not updated correctly
-  // It's possible but requires that you first set the background area black, then white, then add the text
-  //  display->update();
-  display->updateWindow(0, 0, GxEPD_WIDTH, GxEPD_HEIGHT, true);
-  // Power it down to save battery
-  display->powerDown();
-
-  preferences->putLong64("prev_time_unix", rtc->getEpoch());
+  // Updating small parts of the screen requires that you first set the background area black, then white,
+  // then add the text, otherwise we get corrupted parts of the screen. The renderer does exactly that, but
+  // only for the areas which actually changed since the last frame (usually just the minutes)
+  {
+    CPU_PHASE(CpuPhase::EPD);
+    renderer->flush();
+    // Power it down to save battery
+    PROFILE_SCOPE(ProfileStage::DISPLAY_POWER_DOWN);
+    display->powerDown();
+  }
 
   // Make the motor vibration for 0.5 seconds
   if (initAlarm) {
@@ -76,58 +99,76 @@ void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class
     initAlarm = false;
   }
 
-  // Get the current minutes
-  int currentMinutes = rtc->getMinute();
-  // Get the current hour
-  int currentHour = rtc->getHour(true);
+  // The network session writes the hot state as well, wait for it before touching it again
+  if (network && finishWiFiActions(renderer)) {
+    PROFILE_SCOPE(ProfileStage::DISPLAY_POWER_DOWN);
+    display->powerDown();
+  }
 
   // Update the battery status every 10 minutes, its enough, save on battery
-  if (currentMinutes % 10 == 0) {
-    calculateBatteryStatus(preferences);
+  // In between the voltage is only sampled into the average
+  bool checkpoint = false;
+  if (schedulerTake(ScheduledJob::BATTERY, batteryStatus)) {
+    batteryStatus = calculateBatteryStatus();
+    // The RTC memory is gone when the battery runs out, keep the checkpoint up to date from here on
+    checkpoint = batteryStatus < SCHEDULER_LOW_BATTERY;
+  } else {
+    sampleBattery();
   }
-  // Perform the WiFi actions every 4 hours when the minutes == 0
-  if (currentMinutes == 0 && (currentHour % 4) == 0) {
-    performWiFiActions(display, preferences);
+  // Checkpoint the hot state to NVS every hour
+  if (schedulerTake(ScheduledJob::CHECKPOINT, batteryStatus) || checkpoint) {
+    hotStateCheckpoint(preferences);
   }
 
   // snooze....
   log(LogLevel::INFO, "Going to sleep...");
   digitalWrite(PWR_EN, LOW);
   esp_sleep_enable_ext0_wakeup((gpio_num_t)PIN_KEY, 0);
-  esp_sleep_enable_timer_wakeup(UPDATE_WAKEUP_TIMER_US);
+  // Wake up right in time for the next minute (or the next job)
+  uint64_t sleepUs = schedulerSleepUs();
+  batteryAccountWake(micros(), sleepUs);
+  esp_sleep_enable_timer_wakeup(sleepUs);
+  profileEndWake();
   esp_deep_sleep_start();
 }
 
 //
 // Wake up the device from deep sleep and perform actions for the focus timer
 //
-void wakeupDeepSleep(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences) {
+void wakeupDeepSleep(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, FrameRenderer *renderer, ESP32Time *rtc,
+                     Preferences *preferences) {
   log(LogLevel::INFO, "WAKEUP_DEEP_SLEEP");
-  setCpuFrequencyMhz(80);
+  governorBegin();
 
-  // Get the battery status from the preferences
-  calculateBatteryStatus(preferences); // re-calculate it
-  int batteryStatus = preferences->getInt("battery_level", 0);
+  // Get the battery status
+  int batteryStatus = calculateBatteryStatus(); // re-calculate it
+  schedulerRan(ScheduledJob::BATTERY);
 
-  // Let us start focus time if not already running. Get the focus time from the preferences
-  int focusTime = preferences->getInt("focus_time", 0);
+  // Let us start focus time if not already running
+  int focusTime = hotState().focusTime;
   if (focusTime <= 0) {
     // Start the focus time to 25 minutes
-    preferences->putInt("focus_time", 25);
     focusTime = 25;
   } else if (focusTime == 99) {
     // Special case, if the focus time is 99, then we need to reset it to 0
-    preferences->putInt("focus_time", 0);
     focusTime = 0;
   }
+  hotStateSetFocusTime(focusTime);
 
-  // Draw the time and date + battery status
-  drawHomeUI(display, rtc, batteryStatus);
-  // Get the weather from the preferences and display it
-  displayWeather(display, preferences->getString("weather_c"), preferences->getString("weather_t"));
-  displayFocusTime(display, focusTime);
+  // The user is here, a good moment to checkpoint the hot state before staying awake for a while
+  hotStateCheckpoint(preferences);
+  schedulerRan(ScheduledJob::CHECKPOINT);
 
-  display->update(); // Make a full flashing update!
+  // Draw the time and date + battery status, weather and the focus time
+  {
+    CPU_PHASE(CpuPhase::RENDER);
+    updateHomeUI(renderer->canvas(), rtc, batteryStatus, focusTime, hotState().weatherCondition, hotState().weatherTemp, true);
+  }
+
+  {
+    CPU_PHASE(CpuPhase::EPD);
+    renderer->flushFull(); // Make a full flashing update!
+  }
 
   log(LogLevel::INFO, "Totally awake now mate...");
 }
@@ -136,7 +177,9 @@ void wakeupDeepSleep(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Cl
 void wakeupInitLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc) {
   if (sleepTimer == 30) {
     *wakeupType = WakeupFlag::WAKEUP_LIGHT;
+    batteryAccountWake(micros(), 1000000);
     esp_sleep_enable_timer_wakeup(1000000);
+    profileEndWake();
     esp_deep_sleep_start();
   }
 }
@@ -148,7 +191,10 @@ void wakeupLightLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Clas
   if (sleepTimer == 15) {
     digitalWrite(PWR_EN, LOW);
     esp_sleep_enable_ext0_wakeup((gpio_num_t)PIN_KEY, 0);
-    esp_sleep_enable_timer_wakeup(UPDATE_WAKEUP_TIMER_US - 15000000);
+    uint64_t sleepUs = schedulerSleepUs();
+    batteryAccountWake(micros(), sleepUs);
+    esp_sleep_enable_timer_wakeup(sleepUs);
+    profileEndWake();
     esp_deep_sleep_start();
   }
 }
@@ -166,130 +212,64 @@ void wakeupDeepSleepLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_
 }
 
 /**
- * Perform the WiFi actions such as connecting to the network and getting the time
- * This strange configuration was the only way I managed to get the WiFi working on this device
- * don't mess with it! :-)
+ * Get the time from the NTP server, the offset it finds tells us how far the RTC drifted
  */
-void performWiFiActions(GxEPD_Class *display, Preferences *preferences) {
-
-  String wifi_ssid = preferences->getString("wifi_ssid", "");
-  String wifi_password = preferences->getString("wifi_passwd", "");
-
-  // If the wifi is not configured, we can't do anything, so return
-  if (wifi_ssid.length() == 0 || wifi_password.length() == 0) {
-    log(LogLevel::ERROR, "WiFi not configured, skipping WiFi actions");
-    return;
-  }
-
-  // Turn on the wifi
-  WiFi.mode(WIFI_STA);
+static bool syncTime(Preferences *preferences) {
+  NtpResult ntp;
+  if (!ntpQueryServers(&ntp))
+    return false;
+  timekeeperSynced(ntp.offsetUs);
+  log(LogLevel::SUCCESS, (String("NTP round trip ") + ntp.rttUs + " us, stratum " + ntp.stratum).c_str());
+  return true;
+}
 
-  int n = WiFi.scanNetworks();
-  if (n == 0) {
-    Serial.println("no networks found");
-  } else {
-    Serial.print(n);
-    Serial.println(" networks found");
-
-    for (int i = 0; i < n; ++i) {
-      // Print SSID and RSSI for each network found
-      Serial.printf("%2d", i + 1);
-      Serial.print(" | ");
-      Serial.printf("%-32.32s", WiFi.SSID(i).c_str());
-      Serial.print(" | ");
-      Serial.printf("%4d", WiFi.RSSI(i));
-      Serial.print(" | ");
-      Serial.printf("%2d", WiFi.channel(i));
-      Serial.print(" | ");
-      switch (WiFi.encryptionType(i)) {
-      case WIFI_AUTH_OPEN:
-        Serial.print("open");
-        break;
-      case WIFI_AUTH_WEP:
-        Serial.print("WEP");
-        break;
-      case WIFI_AUTH_WPA_PSK:
-        Serial.print("WPA");
-        break;
-      case WIFI_AUTH_WPA2_PSK:
-        Serial.print("WPA2");
-        break;
-      case WIFI_AUTH_WPA_WPA2_PSK:
-        Serial.print("WPA+WPA2");
-        break;
-      case WIFI_AUTH_WPA2_ENTERPRISE:
-        Serial.print("WPA2-EAP");
-        break;
-      case WIFI_AUTH_WPA3_PSK:
-        Serial.print("WPA3");
-        break;
-      case WIFI_AUTH_WPA2_WPA3_PSK:
-        Serial.print("WPA2+WPA3");
-        break;
-      case WIFI_AUTH_WAPI_PSK:
-        Serial.print("WAPI");
-        break;
-      default:
-        Serial.print("unknown");
-      }
-      Serial.println();
-      delay(10);
-    }
+/**
+ * Queue the ntp and weather jobs and start the network session that runs them on the protocol core
+ * Returns false when the session did not start (no WiFi credentials), then the WIFI job counts as run and
+ * finishWiFiActions() must not be called
+ */
+bool beginWiFiActions(Preferences *preferences) {
+  netSessionAdd("ntp", syncTime);
+  netSessionAdd("weather", getWeather);
+  if (!netSessionBegin(preferences)) {
+    // If the wifi is not configured, we can't do anything
+    schedulerRan(ScheduledJob::WIFI);
+    return false;
   }
+  return true;
+}
 
-  WiFi.mode(WIFI_STA);
-  WiFi.persistent(false);
-  WiFi.setTxPower(WIFI_POWER_2dBm); // REQUIRED otherwise WiFi does not work!
-  WiFi.hostname("LilyPaperWatch");
-  WiFi.begin(wifi_ssid.c_str(), wifi_password.c_str());
-
-  // Wait for connection
-  /*
-  Code Value Meaning
-  WL_IDLE_STATUS 0 WiFi is in process of changing between statuses
-  WL_NO_SSID_AVAIL 1 SSID cannot be reached
-  WL_SCAN_COMPLETED 2
-  WL_CONNECTED 3 Successful connection is established
-  WL_CONNECT_FAILED 4 Password is incorrect
-  WL_CONNECTION_LOST 5
-  WL_DISCONNECTED 6 Module is not configured in station mode
-
-  You should normally get a couple of seconds of "6" followed by a single "3".
-  */
-  uint8_t i = 0;
-  // while (WiFi.localIP().toString() == "0.0.0.0" && i++ < 60) {
-  while (WiFi.status() != WL_CONNECTED && i++ < 60) { // Wait for the WiFI connection completion
-    delay(500);
-    Serial.print(".");
-    Serial.print(WiFi.status());
-  }
+/**
+ * Wait for the WiFi actions (the radio is off when they are done) and show what they brought
+ * Returns true when the display was refreshed
+ */
+bool finishWiFiActions(FrameRenderer *renderer) {
+  PROFILE_SCOPE(ProfileStage::WIFI);
+  bool connected = netSessionEnd();
 
   // The WiFi on this device fails all the time, it's completely random when it does or does not connect
   // I have a connection success rate of 1:20
-  if (WiFi.status() != WL_CONNECTED) {
-    Serial.println("Failed to connect to WiFi");
-    // disconnect WiFi as it's no longer needed
-    WiFi.disconnect(true);
-    WiFi.mode(WIFI_OFF);
-    disableWifiDisplay(display);
+  if (!connected) {
+    disableWifiDisplay(renderer->canvas());
     log(LogLevel::ERROR, "WiFi failed to connect");
-  } else {
-    log(LogLevel::SUCCESS, "WiFi initiliazed");
-    // Indicate we are connected to WiFi
-    enableWifiDisplay(display);
-    // Get the time from the NTP server
-    configTime(GMT_OFFSET_SEC, DAY_LIGHT_OFFSET_SEC, NTP_SERVER1);
-    // Get the current weather
-    getWeather(display, preferences);
-    display->update(); // Update the display otherwise we see nothing new
-
-    Serial.print("# IP address: ");
-    Serial.println(WiFi.localIP());
-
-    // Disconnect WiFi as it's no longer needed, saves lots of power
-    WiFi.disconnect(true);
-    WiFi.mode(WIFI_OFF);
+    // Try again later and later while the network stays away
+    schedulerDefer(ScheduledJob::WIFI, wifiBackoffS());
+    return false;
+  }
+
+  log(LogLevel::SUCCESS, "WiFi actions done");
+  schedulerRan(ScheduledJob::WIFI);
+  // Indicate we were connected to WiFi, and the weather
+  {
+    CPU_PHASE(CpuPhase::RENDER);
+    enableWifiDisplay(renderer->canvas());
+    displayWeather(renderer->canvas(), hotState().weatherCondition, hotState().weatherTemp);
+  }
+  {
+    CPU_PHASE(CpuPhase::EPD);
+    renderer->flush(); // Update the display otherwise we see nothing new
   }
+  return true;
 }
 
 /**
@@ -7,7 +7,17 @@
 #include "WiFi.h"
 #include "home.h"
 #include "lib/battery.h"
+#include "lib/connection.h"
+#include "lib/forecast.h"
+#include "lib/governor.h"
+#include "lib/hotstate.h"
 #include "lib/log.h"
+#include "lib/netsession.h"
+#include "lib/ntp.h"
+#include "lib/profile.h"
+#include "lib/renderer.h"
+#include "lib/scheduler.h"
+#include "lib/timekeeper.h"
 #include "os_config.h"
 #include "weather.h"
 
@@ -16,12 +26,16 @@ enum class AwakeState { APPS_MENU};
 
 void playAlarm();
 
-void wakeupInit(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences);
-void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences);
-void wakeupDeepSleep(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, ESP32Time *rtc, Preferences *preferences);
+void wakeupInit(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, FrameRenderer *renderer, ESP32Time *rtc,
+                Preferences *preferences);
+void wakeupLight(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, FrameRenderer *renderer, ESP32Time *rtc,
+                 Preferences *preferences);
+void wakeupDeepSleep(WakeupFlag *wakeupType, unsigned int *wakeupCount, GxEPD_Class *display, FrameRenderer *renderer, ESP32Time *rtc,
+                     Preferences *preferences);
 
 void wakeupInitLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc);
 void wakeupLightLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc);
 void wakeupDeepSleepLoop(WakeupFlag *wakeupType, unsigned int sleepTimer, GxEPD_Class *display, ESP32Time *rtc, AwakeState awakeState);
 
-void performWiFiActions(GxEPD_Class *display, Preferences *preferences);
+bool beginWiFiActions(Preferences *preferences);
+bool finishWiFiActions(FrameRenderer *renderer);
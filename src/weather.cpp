@@ -5,84 +5,128 @@
  */
 #include "weather.h"
 
-void getWeather(GxEPD_Class *display, Preferences *preferences) {
+/**
+ * Feed the response body to the parser in small pieces as it arrives, true when the whole document was parsed
+ */
+static bool readWeather(WiFiClient *stream, JsonStream *parser) {
+  CPU_PHASE(CpuPhase::PARSE);
+  char buffer[WEATHER_READ_CHUNK];
+  uint32_t lastData = millis();
+  while (!parser->done() && !parser->failed() && millis() - lastData < WEATHER_READ_TIMEOUT_MS) {
+    int available = stream->available();
+    if (available <= 0) {
+      if (!stream->connected())
+        break;
+      delay(1);
+      continue;
+    }
+    int n = stream->read((uint8_t *)buffer, min(available, (int)sizeof(buffer)));
+    if (n > 0) {
+      parser->feed(buffer, n);
+      lastData = millis();
+    }
+  }
+  return parser->done();
+}
+
+bool getWeather(Preferences *preferences) {
 
   // Get the weather api key from the preferences
   if (strlen(preferences->getString("weather_api_key").c_str()) == 0) {
     log(LogLevel::INFO, "Weather API Key not set");
-    return;
+    return true;
   }
 
   // Get the weather location from the preferences
   if (strlen(preferences->getString("location").c_str()) == 0) {
     log(LogLevel::WARNING, "Weather Location not set");
-    return;
+    return true;
   }
 
   // The current location
   String location = preferences->getString("location");
 
-  String condition = "";
-  String temp_c = "";
-
+  // Declared before the HTTPClient, which stops it when it goes away
+  ResumableTlsClient client;
   HTTPClient http;
 
   // Your Domain name with URL path or IP address with path
-  String serverName = "https://api.weatherapi.com/v1/current.json";
-  String parameters = "?key=" + preferences->getString("weather_api_key") + "&q=" + location + "&aqi=no";
+  // The forecast of today and tomorrow, together they always hold the next 24 hours
+  String serverName = "https://api.weatherapi.com/v1/forecast.json";
+  String parameters = "?key=" + preferences->getString("weather_api_key") + "&q=" + location + "&days=2&aqi=no&alerts=no";
 
   // Your Domain name with URL path or IP address with path
   serverName += parameters;
+
+  // The weather we have is still fresh by the max-age of the last response, no request at all
+  time_t now = time(NULL);
+  if (httpCacheFresh(preferences, serverName.c_str(), now)) {
+    log(LogLevel::INFO, "Weather still fresh, not requested");
+    return true;
+  }
+
   Serial.print("Requesting URL: ");
   Serial.println(serverName);
 
-  http.begin(serverName.c_str());
+  // HTTP/1.0 so the body is not chunked, the stream is the plain JSON
+  http.useHTTP10(true);
+  // Over the TLS client that resumes the session of the last request
+  http.begin(client, serverName);
+
+  // Only send the weather when it changed since the last response, otherwise the answer is a 304 without a body
+  String ifNoneMatch, ifModifiedSince;
+  httpCacheConditions(preferences, serverName.c_str(), &ifNoneMatch, &ifModifiedSince);
+  if (ifNoneMatch.length() > 0)
+    http.addHeader("If-None-Match", ifNoneMatch);
+  if (ifModifiedSince.length() > 0)
+    http.addHeader("If-Modified-Since", ifModifiedSince);
+  http.collectHeaders(httpCacheHeaders, sizeof(httpCacheHeaders) / sizeof(httpCacheHeaders[0]));
 
   // Send HTTP GET request
   int httpResponseCode = http.GET();
 
-  if (httpResponseCode > 0) {
+  if (httpResponseCode == HTTP_CODE_NOT_MODIFIED) {
+    // The weather in the hot state and the forecast are still the current ones
+    log(LogLevel::INFO, "Weather not modified");
+    httpCacheUpdate(preferences, serverName.c_str(), httpResponseCode, http.header("ETag"), http.header("Last-Modified"),
+                    http.header("Cache-Control"), http.header("Age"), now);
+  } else if (httpResponseCode == HTTP_CODE_OK) {
     Serial.print("HTTP Response code: ");
     Serial.println(httpResponseCode);
 
-    // The payload is a JSON object, we need to get current.condition.text & current.temp_c
-
-    // Get the json object from the response
-    String json = http.getString();
-    // Serial.println(json);
-
-    // Get the json object from the response
-    StaticJsonDocument<2048> doc;
-
-    // Parse the incoming JSON response
-    DeserializationError error = deserializeJson(doc, json);
-
-    // Test if parsing succeeds.
-    if (error) {
-      Serial.print(F("deserializeJson() failed: "));
-      Serial.println(error.c_str());
-      return;
+    // The payload is a JSON object, we need current.condition.text & current.temp_c and the coming hours
+    // It is parsed while it comes in, only these values are kept
+    WeatherResponse weather;
+    weatherJsonBegin(&weather, now);
+    JsonStream parser(weatherJsonValue, &weather);
+    if (!readWeather(http.getStreamPtr(), &parser)) {
+      log(LogLevel::ERROR, parser.failed() ? "Weather response is not valid JSON" : "Weather response incomplete");
+      http.end();
+      return false;
     }
 
-    // Extract values
-    condition = doc["current"]["condition"]["text"].as<String>();
-    temp_c = doc["current"]["temp_c"].as<String>();
-
-    // Save the current condition to the preferences
-    bool result = preferences->putString("weather_c", condition);
-    // Check if preference was saved
-    if (!result) {
-      log(LogLevel::ERROR, "Failed to save preference");
-    }
-    preferences->putString("weather_t", temp_c);
-
+    // Save the current condition to the hot state, the next checkpoint writes it to the preferences
+    // A body without it keeps the one we have, the forecast below can still be new
+    if (weather.condition[0] != '\0')
+      hotStateSetWeather(weather.condition, weather.temp);
+    // The following hours come from the forecast
+    if (weather.count > 0)
+      forecastStore(preferences, weather.hours, weather.count, now);
+    log(LogLevel::INFO, (String(weather.count) + " hours of forecast").c_str());
+    // What the next request can ask with
+    httpCacheUpdate(preferences, serverName.c_str(), httpResponseCode, http.header("ETag"), http.header("Last-Modified"),
+                    http.header("Cache-Control"), http.header("Age"), now);
+
+  } else if (httpResponseCode > 0) {
+    // A bad key, a used up quota or an unknown location, the JSON error body is not the weather
+    log(LogLevel::ERROR, (String("Weather request failed with HTTP ") + httpResponseCode).c_str());
+    // Drops the validators, the next request asks for the whole response
+    httpCacheUpdate(preferences, serverName.c_str(), httpResponseCode, "", "", "", "", now);
   } else {
     Serial.print("Error code: ");
     Serial.println(httpResponseCode);
   }
   // Free resources
   http.end();
-
-  // return the condition and temp_c
-  displayWeather(display, condition, temp_c);
+  return httpResponseCode == HTTP_CODE_OK || httpResponseCode == HTTP_CODE_NOT_MODIFIED;
 }
\ No newline at end of file
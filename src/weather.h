@@ -4,12 +4,18 @@
 #include "GxEPD.h"
 #include "Preferences.h"
 #include "WiFi.h"
-#include "WiFiClientSecure.h"
 #include "HTTPClient.h"
-#include "ArduinoJson.h"
 
 #include "home.h"
+#include "lib/forecast.h"
+#include "lib/governor.h"
+#include "lib/hotstate.h"
+#include "lib/httpcache.h"
+#include "lib/jsonstream.h"
 #include "lib/log.h"
+#include "lib/tlsclient.h"
+#include "lib/weatherjson.h"
 #include "os_config.h"
 
-void getWeather(GxEPD_Class *display, Preferences *preferences);
+// Fetch the weather and the forecast into the hot state and the forecast store, a network session job
+bool getWeather(Preferences *preferences);
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+Convert an Adafruit GFX font header into a run length encoded font (RleFont, see src/lib/ui.h)
+
+Same format as `fontconvert -r` (lib/Adafruit-GFX/fontconvert) writes, for fonts of which only the converted
+header is around. The glyph pixels are walked column by column (top to bottom, then left to right) and stored as
+the lengths of alternating runs of background and ink, starting with background. Runs longer than 255 are split
+with an empty run of the other color. A column of the UI is a row of the panel (setRotation(1)), so every ink run
+is drawn as one horizontal span of the framebuffer.
+
+Prints the flash used by the bitmaps of both formats to stderr.
+
+Usage (from the repository root):
+  python3 tools/compress_font.py src/resources/fonts/Outfit_80036pt7b.h > src/resources/fonts/Outfit_80036pt7b_rle.h
+"""
+import os
+import re
+import sys
+
+
+def parse_font(path):
+    source = open(path).read()
+    name = re.search(r"const uint8_t (\w+)Bitmaps\[\]", source).group(1)
+    bitmap_src = re.search(r"Bitmaps\[\] PROGMEM = \{(.*?)\};", source, re.S).group(1)
+    bitmaps = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_src)]
+    glyph_src = re.search(r"Glyphs\[\] PROGMEM = \{(.*?)\};", source, re.S).group(1)
+    glyphs = [tuple(int(v) for v in g) for g in re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyph_src)]
+    first, last, y_advance = re.search(r"0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+),\s*(\d+)\s*\};", source).groups()
+    return name, bitmaps, glyphs, int(first, 16), int(last, 16), int(y_advance)
+
+
+def encode_run(length):
+    out = []
+    while length > 255:
+        out += [255, 0]
+        length -= 255
+    return out + [length]
+
+
+def encode_glyph(bitmaps, glyph):
+    offset, width, height = glyph[0], glyph[1], glyph[2]
+    out = []
+    ink = 0
+    length = 0
+    for x in range(width):
+        for y in range(height):
+            bit = y * width + x
+            pixel = (bitmaps[offset + bit // 8] >> (7 - bit % 8)) & 1
+            if pixel != ink:
+                out += encode_run(length)
+                ink = pixel
+                length = 0
+            length += 1
+    if length:
+        out += encode_run(length)
+    return out
+
+
+def main():
+    path = sys.argv[1]
+    name, bitmaps, glyphs, first, last, y_advance = parse_font(path)
+
+    runs = []
+    table = []
+    for glyph in glyphs:
+        table.append((len(runs),) + glyph[1:])
+        runs += encode_glyph(bitmaps, glyph)
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by tools/compress_font.py from %s, do not edit" % os.path.basename(path))
+    out.append("// Run length encoded glyphs, %d bytes instead of %d bytes of bitmaps" % (len(runs), len(bitmaps)))
+    out.append("")
+    out.append("const uint8_t %sRuns[] PROGMEM = {" % name)
+    for i in range(0, len(runs), 24):
+        out.append("    " + ", ".join("0x%02X" % b for b in runs[i : i + 24]) + ",")
+    out[-1] = out[-1][:-1] + "};"
+    out.append("")
+    out.append("const GFXglyph %sRleGlyphs[] PROGMEM = {" % name)
+    for i, glyph in enumerate(table):
+        entry = "{%d, %d, %d, %d, %d, %d}" % glyph
+        out.append("    %-28s // 0x%02X %s" % (entry + ("," if i < len(table) - 1 else "};"), first + i, repr(chr(first + i))))
+    out.append("")
+    out.append("const RleFont %sRle PROGMEM = {{(uint8_t *)%sRuns, (GFXglyph *)%sRleGlyphs, 0x%02X, 0x%02X, %d}};" % (name, name, name, first, last, y_advance))
+    out.append("")
+    print("\n".join(out))
+
+    sys.stderr.write("%s: bitmaps %d bytes, runs %d bytes (%.0f%%)\n" % (name, len(bitmaps), len(runs), 100.0 * len(runs) / len(bitmaps)))
+
+
+if __name__ == "__main__":
+    main()
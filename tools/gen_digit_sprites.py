@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+"""
+Pre-rasterize the clock glyphs ('0'-'9' and ':') of an Adafruit GFX font into digit sprites
+
+The sprites are stored in the orientation of the display (setRotation(1)): every glyph column becomes one
+row of the panel buffer, stored as whole bytes, so they can be copied into the framebuffer without
+decoding the glyph bit by bit. Bit 0x80 of the first byte is the lowest pixel of the glyph line
+(`descent` pixels below the baseline), the following bits go up towards the top of the glyph.
+
+Usage (from the repository root):
+  python3 tools/gen_digit_sprites.py src/resources/fonts/Outfit_80036pt7b.h > src/resources/fonts/Outfit_80036pt7b_digits.h
+"""
+import os
+import re
+import sys
+
+CHARS = "0123456789:"
+
+
+def parse_font(path):
+    source = open(path).read()
+    name = re.search(r"const uint8_t (\w+)Bitmaps\[\]", source).group(1)
+    bitmap_src = re.search(r"Bitmaps\[\] PROGMEM = \{(.*?)\};", source, re.S).group(1)
+    bitmaps = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap_src)]
+    glyph_src = re.search(r"Glyphs\[\] PROGMEM = \{(.*?)\};", source, re.S).group(1)
+    glyphs = [tuple(int(v) for v in g) for g in re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyph_src)]
+    first = int(re.search(r"0x([0-9A-Fa-f]+),\s*0x[0-9A-Fa-f]+,\s*\d+\};", source).group(1), 16)
+    return name, bitmaps, glyphs, first
+
+
+def glyph_pixel(bitmaps, glyph, gx, gy):
+    offset, width = glyph[0], glyph[1]
+    bit = gy * width + gx
+    return (bitmaps[offset + bit // 8] >> (7 - bit % 8)) & 1
+
+
+def main():
+    path = sys.argv[1]
+    name, bitmaps, glyphs, first = parse_font(path)
+    selected = [glyphs[ord(c) - first] for c in CHARS]
+
+    # The vertical extent (relative to the baseline) covered by all the sprites
+    top = min(g[5] for g in selected)
+    descent = max(g[5] + g[2] - 1 for g in selected)
+    row_bytes = (descent - top + 1 + 7) // 8
+
+    data = []
+    sprites = []
+    for c, glyph in zip(CHARS, selected):
+        _, width, height, x_advance, x_offset, y_offset = glyph
+        sprites.append((len(data), width, x_advance, x_offset, c))
+        for gx in range(width):
+            row = [0] * row_bytes
+            for gy in range(height):
+                if glyph_pixel(bitmaps, glyph, gx, gy):
+                    k = descent - (y_offset + gy)
+                    row[k // 8] |= 0x80 >> (k % 8)
+            data.extend(row)
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by tools/gen_digit_sprites.py from %s, do not edit" % os.path.basename(path))
+    out.append("// Clock glyphs '0'-'9' and ':' rotated into the panel orientation, %d bytes per glyph column" % row_bytes)
+    out.append("")
+    out.append("const uint8_t %sDigitBitmaps[] PROGMEM = {" % name)
+    for i in range(0, len(data), 12):
+        out.append("    " + ", ".join("0x%02X" % b for b in data[i : i + 12]) + ",")
+    out[-1] = out[-1][:-1] + "};"
+    out.append("")
+    out.append("const DigitSprite %sDigitSprites[] PROGMEM = {" % name)
+    for i, (offset, width, x_advance, x_offset, c) in enumerate(sprites):
+        entry = "{%d, %d, %d, %d}" % (offset, width, x_advance, x_offset)
+        out.append("    %-22s // '%s'" % (entry + ("," if i < len(sprites) - 1 else "};"), c))
+    out.append("")
+    out.append("const DigitSpriteFont %sDigits PROGMEM = {" % name)
+    out.append("    (uint8_t *)%sDigitBitmaps," % name)
+    out.append("    (DigitSprite *)%sDigitSprites," % name)
+    out.append("    %d, %d};" % (row_bytes, descent))
+    out.append("")
+    out.append("// Approx. %d bytes" % (len(data) + len(sprites) * 5 + 10))
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+"""
+Generate the constexpr metrics (width, xAdvance, xOffset of every glyph) of an Adafruit GFX font
+
+The GFXglyph tables of the fonts are plain PROGMEM data, the compiler can not look into them. With the
+metrics as constexpr data the width of literal and fixed format strings (see lib/metrics.h) is worked out at
+compile time, and measuring at runtime does not have to go through the glyph table of the font.
+
+Usage (from the repository root):
+  python3 tools/gen_font_metrics.py src/resources/fonts/Outfit_60011pt7b.h > src/resources/fonts/Outfit_60011pt7b_metrics.h
+"""
+import os
+import re
+import sys
+
+
+def parse_font(path):
+    source = open(path).read()
+    name = re.search(r"const uint8_t (\w+)Bitmaps\[\]", source).group(1)
+    glyph_src = re.search(r"Glyphs\[\] PROGMEM = \{(.*?)\};", source, re.S).group(1)
+    glyphs = [tuple(int(v) for v in g) for g in re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyph_src)]
+    first, last = (int(v, 16) for v in re.search(r"0x([0-9A-Fa-f]+),\s*0x([0-9A-Fa-f]+),\s*\d+\};", source).groups())
+    return name, glyphs, first, last
+
+
+def main():
+    path = sys.argv[1]
+    name, glyphs, first, last = parse_font(path)
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("// Generated by tools/gen_font_metrics.py from %s, do not edit" % os.path.basename(path))
+    out.append("")
+    out.append("constexpr GlyphMetrics %sGlyphMetrics[] = {" % name)
+    for i, glyph in enumerate(glyphs):
+        _, width, _, x_advance, x_offset, _ = glyph
+        entry = "{%d, %d, %d}" % (width, x_advance, x_offset)
+        c = first + i
+        out.append("    %-16s // 0x%02X %s" % (entry + ("," if i < len(glyphs) - 1 else "};"), c, repr(chr(c))))
+    out.append("")
+    out.append("constexpr FontMetrics %sMetrics = {%sGlyphMetrics, 0x%02X, 0x%02X};" % (name, name, first, last))
+    out.append("")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
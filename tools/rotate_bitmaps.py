@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""
+Rotate drawBitmap() style bitmaps into the orientation of the panel buffer
+
+A bitmap rotated for rotation R can be copied into a RotatedCanvas<R> with drawRotatedBitmap() as whole bytes
+(blitRaw), instead of going through the rotation transform for every pixel. The arrays keep their name with an
+_r<rotation> suffix, the width and height passed to drawRotatedBitmap() stay the ones of the original bitmap.
+
+Usage (from the repository root):
+  python3 tools/rotate_bitmaps.py src/resources/icons.h 1 icon_wifi_small:28x28 ... > src/resources/icons_rotated.h
+"""
+import os
+import re
+import sys
+
+
+def parse_bitmaps(path):
+    source = open(path).read()
+    bitmaps = {}
+    for name, data in re.findall(r"const unsigned char (\w+)\[\] PROGMEM = \{(.*?)\};", source, re.S):
+        bitmaps[name] = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", data)]
+    return bitmaps
+
+
+def rotate(data, width, height, rotation):
+    stride = (width + 7) // 8
+    # Logical pixel (x, y) of the bitmap -> pixel of the rotated bitmap, same transform as GFXcanvas1
+    if rotation == 0:
+        size, place = (width, height), lambda x, y: (x, y)
+    elif rotation == 1:
+        size, place = (height, width), lambda x, y: (height - 1 - y, x)
+    elif rotation == 2:
+        size, place = (width, height), lambda x, y: (width - 1 - x, height - 1 - y)
+    else:
+        size, place = (height, width), lambda x, y: (y, width - 1 - x)
+
+    out_stride = (size[0] + 7) // 8
+    out = [0] * (out_stride * size[1])
+    for y in range(height):
+        for x in range(width):
+            if data[y * stride + x // 8] & (0x80 >> (x % 8)):
+                rx, ry = place(x, y)
+                out[ry * out_stride + rx // 8] |= 0x80 >> (rx % 8)
+    return out
+
+
+def main():
+    path = sys.argv[1]
+    rotation = int(sys.argv[2])
+    bitmaps = parse_bitmaps(path)
+
+    out = []
+    out.append("#pragma once")
+    out.append("")
+    out.append("#include \"Arduino.h\"")
+    out.append("")
+    out.append("// Generated by tools/rotate_bitmaps.py from %s, do not edit" % os.path.basename(path))
+    out.append("// Rotated into the panel orientation for rotation %d, draw them with RotatedCanvas::drawRotatedBitmap()" % rotation)
+    for spec in sys.argv[3:]:
+        name, size = spec.split(":")
+        width, height = (int(v) for v in size.split("x"))
+        data = rotate(bitmaps[name], width, height, rotation)
+        out.append("")
+        out.append("// %dx%d" % (width, height))
+        out.append("const unsigned char %s_r%d[] PROGMEM = {" % (name, rotation))
+        for i in range(0, len(data), 16):
+            out.append("    " + ", ".join("0x%02x" % b for b in data[i : i + 16]) + ",")
+        out[-1] = out[-1][:-1] + "};"
+    out.append("")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()